@@ -0,0 +1,144 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "micro-benchmark.hpp"
+#include "application/primitive-factory.hpp"
+#include "pipeline/histogram.hpp"
+#include "window/window.hpp"
+
+// STD Include //
+#include <cmath>
+#include <tuple>
+
+static void sphereMesh(BenchmarkState &state) {
+    const auto resolution = static_cast<unsigned>(state.getArgument());
+
+    for (auto _: state)
+        doNotOptimize(Sphere::generateMesh(1.0f, resolution, resolution));
+    state.setItemsProcessed(state.getIterations() * resolution * resolution * 2);
+}
+
+MICRO_BENCHMARK(sphereMesh, 16, 32, 64, 128, 256);
+
+static void bezierSurfaceMesh(BenchmarkState &state) {
+    const auto resolution = static_cast<int>(state.getArgument());
+    glm::vec3 controlPoints[4][4];
+    AABB bounds{};
+
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            controlPoints[i][j] = glm::vec3(i - 1.5f, std::sin(i + j), j - 1.5f);
+    for (auto _: state)
+        doNotOptimize(BezierSurface::generateMesh(controlPoints, resolution, resolution, bounds));
+    state.setItemsProcessed(state.getIterations() * resolution * resolution * 2);
+}
+
+MICRO_BENCHMARK(bezierSurfaceMesh, 10, 20, 50, 100, 200);
+
+static void catmullRomCurve(BenchmarkState &state) {
+    const auto resolution = static_cast<int>(state.getArgument());
+    std::vector<glm::vec3> controlPoints;
+    std::vector<unsigned> indices;
+    AABB bounds{};
+
+    for (int index = 0; index < 8; index++)
+        controlPoints.emplace_back(static_cast<float>(index) * 2.0f - 7.0f, std::sin(static_cast<float>(index)), 0.0f);
+    for (auto _: state)
+        doNotOptimize(CatmullRomCurve::generateCurve(controlPoints, resolution, indices, bounds));
+    state.setItemsProcessed(state.getIterations() * (controlPoints.size() - 3) * (resolution + 1));
+}
+
+MICRO_BENCHMARK(catmullRomCurve, 10, 20, 50, 100, 200);
+
+static void grayscaleHistogram(BenchmarkState &state, const int channels) {
+    const auto side = static_cast<int>(state.getArgument());
+    std::vector<unsigned char> pixels(static_cast<size_t>(side) * side * channels);
+    uint32_t seed = 0x12345678;
+
+    for (unsigned char &channel: pixels) {
+        seed = seed * 1664525u + 1013904223u;
+        channel = static_cast<unsigned char>(seed >> 24);
+    }
+    for (auto _: state)
+        doNotOptimize(Histogram::computeGrayscale(pixels.data(), side, side, channels));
+    state.setItemsProcessed(state.getIterations() * side * side);
+}
+
+static void grayscaleHistogramRgb(BenchmarkState &state) {
+    grayscaleHistogram(state, 3);
+}
+
+static void grayscaleHistogramRgba(BenchmarkState &state) {
+    grayscaleHistogram(state, 4);
+}
+
+MICRO_BENCHMARK(grayscaleHistogramRgb, 256, 512, 1024, 2048, 4096);
+MICRO_BENCHMARK(grayscaleHistogramRgba, 256, 512, 1024, 2048, 4096);
+
+// Primitives own GL objects, a hidden window provides the context and is leaked on purpose so that nothing is
+// destroyed after the context during static teardown
+static Window &getHiddenWindow() {
+    static Window *window = [] {
+        auto *created = new Window(Window::WIDTH, Window::HEIGHT, true);
+
+        gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
+        return created;
+    }();
+
+    return *window;
+}
+
+// Picking and culling walk the whole scene store, so a single grid of exactly count primitives is kept alive
+static const PrimitiveList &getPrimitiveGrid(const int64_t count) {
+    static auto *grid = new PrimitiveList;
+    const int columns = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(count))));
+
+    std::ignore = getHiddenWindow();
+    if (static_cast<int64_t>(grid->size()) != count)
+        grid->clear();
+    for (auto index = static_cast<int64_t>(grid->size()); index < count; index++) {
+        const auto primitive = PrimitiveFactory::createPrimitive(CUBE);
+
+        primitive->translate(glm::vec3(static_cast<float>(index % columns - columns / 2) * 3.0f,
+                                       static_cast<float>(index / columns - columns / 2) * 3.0f, -10.0f));
+        grid->push_back(primitive);
+    }
+    return *grid;
+}
+
+static void collisionBox(BenchmarkState &state) {
+    const PrimitiveList &primitives = getPrimitiveGrid(state.getArgument());
+
+    for (auto _: state)
+        for (const auto &primitive: primitives)
+            doNotOptimize(primitive->getCollisionBox());
+    state.setItemsProcessed(state.getIterations() * primitives.size());
+}
+
+MICRO_BENCHMARK(collisionBox, 16, 128, 1024);
+
+static void findNearestPrimitive(BenchmarkState &state) {
+    const PrimitiveList &primitives = getPrimitiveGrid(state.getArgument());
+    const Window &window = getHiddenWindow();
+    const Coordinates center{Window::WIDTH / 2.0, Window::HEIGHT / 2.0};
+
+    for (auto _: state)
+        doNotOptimize(Intersection::findNearestPrimitive(window, center));
+    state.setItemsProcessed(state.getIterations() * primitives.size());
+}
+
+MICRO_BENCHMARK(findNearestPrimitive, 16, 128, 1024);
+
+static void frustumCull(BenchmarkState &state) {
+    const PrimitiveList &primitives = getPrimitiveGrid(state.getArgument());
+    const Window &window = getHiddenWindow();
+    const glm::mat4 viewProjection = window.getProjection() * window.getView();
+    SceneStore &sceneStore = SceneStore::getInstance();
+
+    sceneStore.updateBounds();
+    for (auto _: state)
+        doNotOptimize(sceneStore.cull(viewProjection, SCENE_VISIBLE));
+    state.setItemsProcessed(state.getIterations() * primitives.size());
+}
+
+MICRO_BENCHMARK(frustumCull, 16, 128, 1024);
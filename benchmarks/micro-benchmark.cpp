@@ -0,0 +1,189 @@
+// Header File Include //
+#include "micro-benchmark.hpp"
+#include "application/logger.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <regex>
+#include <string_view>
+
+struct MicroBenchmarkOptions {
+    std::string filter;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 5.0;
+    double batchMilliseconds = 20.0;
+    int repetitions = 7;
+
+    [[nodiscard]] static MicroBenchmarkOptions parse(int argc, char **argv);
+};
+
+struct MicroBenchmarkResult {
+    std::string name;
+    int64_t argument;
+    uint64_t iterations;
+    double medianNs;
+    double minNs;
+    double itemsPerSecond;
+};
+
+bool MicroBenchmarkRegistry::add(const std::string &name, const BenchmarkFunction &function,
+                                 const std::vector<int64_t> &arguments) {
+    for (const int64_t argument: arguments)
+        _benchmarks.push_back({std::format("{}/{}", name, argument), function, argument});
+    return true;
+}
+
+MicroBenchmarkOptions MicroBenchmarkOptions::parse(const int argc, char **argv) {
+    const Logger &logger = Logger::getInstance();
+    MicroBenchmarkOptions options;
+
+    for (int index = 1; index < argc; index++) {
+        const std::string_view argument = argv[index];
+        const size_t separator = argument.find('=');
+        const std::string_view name = argument.substr(0, separator);
+        const std::string_view value = separator == std::string_view::npos ? "" : argument.substr(separator + 1);
+        const auto readNumber = [&](auto &target) {
+            std::remove_reference_t<decltype(target)> parsed{};
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+
+            if (error != std::errc() || end != value.data() + value.size() || parsed <= 0) {
+                logger.warn("Ignoring {}: expected a positive number", argument);
+                return;
+            }
+            target = parsed;
+        };
+
+        if (name == "--filter")
+            options.filter = value;
+        else if (name == "--json")
+            options.jsonPath = value;
+        else if (name == "--baseline")
+            options.baselinePath = value;
+        else if (name == "--threshold")
+            readNumber(options.threshold);
+        else if (name == "--batch-ms")
+            readNumber(options.batchMilliseconds);
+        else if (name == "--repetitions")
+            readNumber(options.repetitions);
+        else
+            logger.warn("Unknown option {}", argument);
+    }
+    return options;
+}
+
+// The batch grows until it outlasts the requested duration, then the median of the repetitions is kept so a
+// single preempted batch does not move the result
+static MicroBenchmarkResult run(const MicroBenchmark &benchmark, const MicroBenchmarkOptions &options) {
+    const double batchNs = options.batchMilliseconds * 1e6;
+    uint64_t iterations = 1;
+    std::vector<double> perIteration;
+    double items = 0.0;
+    double elapsed = 0.0;
+
+    while (iterations < (1ull << 32)) {
+        BenchmarkState state(benchmark.argument, iterations);
+
+        benchmark.function(state);
+        if (state.getElapsedNanoseconds() >= batchNs)
+            break;
+        const double scale = state.getElapsedNanoseconds() > 0.0 ? batchNs * 1.2 / state.getElapsedNanoseconds() : 10.0;
+
+        iterations = std::max(iterations + 1, static_cast<uint64_t>(static_cast<double>(iterations) *
+                                                                     std::min(scale, 10.0)));
+    }
+    for (int repetition = 0; repetition < options.repetitions; repetition++) {
+        BenchmarkState state(benchmark.argument, iterations);
+
+        benchmark.function(state);
+        perIteration.push_back(state.getElapsedNanoseconds() / static_cast<double>(iterations));
+        items += static_cast<double>(state.getItemsProcessed());
+        elapsed += state.getElapsedNanoseconds();
+    }
+    std::ranges::sort(perIteration);
+    return {benchmark.name, benchmark.argument, iterations, perIteration[perIteration.size() / 2],
+            perIteration.front(), elapsed > 0.0 ? items / (elapsed * 1e-9) : 0.0};
+}
+
+static std::map<std::string, double> readBaseline(const std::string &path) {
+    const std::regex pattern(R"re("name": "([^"]+)".*"medianNs": ([0-9.eE+-]+))re");
+    std::map<std::string, double> baseline;
+    std::ifstream file(path);
+    std::string line;
+    std::smatch match;
+
+    while (std::getline(file, line))
+        if (std::regex_search(line, match, pattern))
+            baseline[match[1]] = std::stod(match[2]);
+    return baseline;
+}
+
+static bool writeResults(const std::string &path, const std::vector<MicroBenchmarkResult> &results) {
+    std::ofstream file(path, std::ios::trunc);
+
+    if (!file.is_open())
+        return false;
+    file << "{\n  \"benchmarks\": [";
+    for (size_t index = 0; index < results.size(); index++) {
+        const MicroBenchmarkResult &result = results[index];
+
+        file << std::format("{}\n    {{\"name\": \"{}\", \"argument\": {}, \"iterations\": {}, \"medianNs\": {:.3f}, "
+                            "\"minNs\": {:.3f}, \"itemsPerSecond\": {:.1f}}}", index == 0 ? "" : ",", result.name,
+                            result.argument, result.iterations, result.medianNs, result.minNs,
+                            result.itemsPerSecond);
+    }
+    file << "\n  ]\n}\n";
+    return true;
+}
+
+int main(const int argc, char **argv) {
+    const Logger &logger = Logger::getInstance();
+    const MicroBenchmarkOptions options = MicroBenchmarkOptions::parse(argc, argv);
+    const std::map<std::string, double> baseline = options.baselinePath.empty()
+                                                       ? std::map<std::string, double>{}
+                                                       : readBaseline(options.baselinePath);
+    std::vector<MicroBenchmarkResult> results;
+    int regressions = 0;
+
+    if (!options.baselinePath.empty() && baseline.empty())
+        logger.warn("No baseline entries read from {}", options.baselinePath);
+    std::cout << std::format("{:<40} {:>12} {:>14} {:>14} {:>16} {:>10}\n", "Benchmark", "Iterations",
+                             "Median (ns)", "Min (ns)", "Items/s", "Baseline");
+    for (const MicroBenchmark &benchmark: MicroBenchmarkRegistry::getInstance().getBenchmarks()) {
+        if (!options.filter.empty() && !benchmark.name.contains(options.filter))
+            continue;
+        const MicroBenchmarkResult result = run(benchmark, options);
+        const auto reference = baseline.find(result.name);
+        std::string comparison = "-";
+
+        if (reference != baseline.end() && reference->second > 0.0) {
+            const double change = (result.medianNs / reference->second - 1.0) * 100.0;
+
+            comparison = std::format("{:+.1f}%", change);
+            if (change > options.threshold) {
+                comparison += " !";
+                regressions++;
+            }
+        }
+        std::cout << std::format("{:<40} {:>12} {:>14.1f} {:>14.1f} {:>16.0f} {:>10}\n", result.name,
+                                 result.iterations, result.medianNs, result.minNs, result.itemsPerSecond, comparison);
+        results.push_back(result);
+    }
+
+    if (!options.jsonPath.empty()) {
+        if (writeResults(options.jsonPath, results))
+            logger.info("Results written to {}", options.jsonPath);
+        else
+            logger.error("Cannot write results to {}", options.jsonPath);
+    }
+    if (regressions > 0) {
+        logger.error("{} benchmarks regressed by more than {:.1f}% against {}", regressions, options.threshold,
+                     options.baselinePath);
+        return 1;
+    }
+    return 0;
+}
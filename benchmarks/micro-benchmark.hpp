@@ -0,0 +1,107 @@
+#pragma once
+
+// STD Include //
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#define MICRO_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define MICRO_BENCHMARK_CONCAT(a, b) MICRO_BENCHMARK_CONCAT_INNER(a, b)
+
+// Registers function once per argument, every argument is reported as its own "function/argument" entry
+#define MICRO_BENCHMARK(function, ...)                                                                                \
+    static const bool MICRO_BENCHMARK_CONCAT(registered, __LINE__) =                                                  \
+        MicroBenchmarkRegistry::getInstance().add(#function, function, {__VA_ARGS__})
+
+// Keeps the compiler from discarding a result the benchmark never reads
+template<typename T>
+void doNotOptimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// Only the range-for over the state is timed, setup before the loop is free
+class BenchmarkState {
+    using Clock = std::chrono::steady_clock;
+
+    int64_t _argument;
+    uint64_t _iterations;
+    uint64_t _itemsProcessed = 0;
+    Clock::time_point _start;
+    Clock::duration _elapsed{};
+
+public:
+    // Not trivially destructible so that the unused loop variable does not warn
+    struct Value {
+        ~Value() {
+        }
+    };
+
+    struct Iterator {
+        BenchmarkState *state;
+        uint64_t remaining;
+
+        bool operator!=(const Iterator &) {
+            if (remaining != 0)
+                return true;
+            state->_elapsed = Clock::now() - state->_start;
+            return false;
+        }
+
+        void operator++() { remaining--; }
+
+        Value operator*() const { return {}; }
+    };
+
+    explicit BenchmarkState(int64_t argument, uint64_t iterations) : _argument(argument), _iterations(iterations) {
+    }
+
+    Iterator begin() {
+        _start = Clock::now();
+        return {this, _iterations};
+    }
+
+    Iterator end() { return {this, 0}; }
+
+    [[nodiscard]] int64_t getArgument() const { return _argument; }
+
+    [[nodiscard]] uint64_t getIterations() const { return _iterations; }
+
+    [[nodiscard]] double getElapsedNanoseconds() const {
+        return std::chrono::duration<double, std::nano>(_elapsed).count();
+    }
+
+    void setItemsProcessed(uint64_t items) { _itemsProcessed = items; }
+
+    [[nodiscard]] uint64_t getItemsProcessed() const { return _itemsProcessed; }
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkState &)>;
+
+struct MicroBenchmark {
+    std::string name;
+    BenchmarkFunction function;
+    int64_t argument;
+};
+
+class MicroBenchmarkRegistry {
+    std::vector<MicroBenchmark> _benchmarks;
+
+    explicit MicroBenchmarkRegistry() = default;
+
+public:
+    static MicroBenchmarkRegistry &getInstance() {
+        static MicroBenchmarkRegistry instance;
+
+        return instance;
+    }
+
+    bool add(const std::string &name, const BenchmarkFunction &function, const std::vector<int64_t> &arguments);
+
+    [[nodiscard]] const std::vector<MicroBenchmark> &getBenchmarks() const { return _benchmarks; }
+
+    MicroBenchmarkRegistry(const MicroBenchmarkRegistry &) = delete;
+
+    void operator=(const MicroBenchmarkRegistry &) = delete;
+};
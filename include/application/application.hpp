@@ -12,17 +12,37 @@
 #include "application/menu/bezier-surface-menu.hpp"
 #include "application/menu/catmull-rom-menu.hpp"
 #include "application/menu/light-menu.hpp"
+#include "application/menu/profiler-menu.hpp"
+#include "application/menu/gl-stats-menu.hpp"
+#include "application/camera-path.hpp"
+#include "application/event-log.hpp"
+#include "application/frame-stats.hpp"
+#include "application/image-writer.hpp"
+#include "application/profiler.hpp"
+#include "application/run-options.hpp"
+#include "application/video-writer.hpp"
 #include "window/window.hpp"
+#include "pipeline/async-readback.hpp"
+#include "pipeline/gpu-profiler.hpp"
+#include "pipeline/offscreen-target.hpp"
 #include "pipeline/pipeline.hpp"
 #include "pipeline/model.hpp"
 #include "pipeline/histogram.hpp"
 
 class Application {
-    Window _window{Window::WIDTH, Window::HEIGHT};
+    // Timestep of offscreen runs and of recordings, also the frame rate written in the video header
+    static constexpr int FRAME_RATE = 60;
+
+    RunOptions _options;
+    Window _window;
     Pipeline _pipeline;
     std::vector<PrimitivePtr> _primitives;
     std::vector<VectorialPrimitivePtr> _vectorialPrimitives;
     Logger _logger = Logger::getInstance();
+    ImageWriterPtr _imageWriter;
+    AsyncReadbackPtr _readback;
+    VideoWriterPtr _videoWriter;
+    AsyncReadbackPtr _videoReadback;
 
     ConfigurationMenuPtr _configurationMenu;
     GraphMenuPtr _graphMenu;
@@ -34,17 +54,33 @@ class Application {
     BezierSurfaceMenuPtr _bezierSurfaceMenu;
     CatmullRomMenuPtr _catmullRomMenu;
     LightMenuPtr _lightMenu;
+    ProfilerMenuPtr _profilerMenu;
+#ifdef GL_STATS_ENABLED
+    GlStatsMenuPtr _glStatsMenu;
+#endif
 
     glm::vec2 _primitiveMenuPosition = glm::vec2(-1.0f);
     glm::vec2 _modelMenuPosition = glm::vec2(-1.0f);
     glm::vec2 _sceneMenuPosition{0.0f, 300.0f};
     PrimitivePtr _selectedPrimitive = nullptr;
     bool _showImgui = true;
+    bool _showProfiler = false;
 
     void initializeDefaultScene();
 
+    // Frames of the given size are streamed to the record target until stopRecording
+    void startRecording(int width, int height);
+
+    void stopRecording();
+
+    // Frame time and per pass GL counters of the frame that just ended, when the event log is open
+    void recordFrameEvents(double milliseconds) const;
+
+    // Renders the warm-up and measured frames into the target at a fixed timestep
+    FrameStats renderOffscreen(const OffscreenTarget &target, const CameraPath &cameraPath, bool capture);
+
 public:
-    Application();
+    explicit Application(const RunOptions &options = {});
 
     Application(const Application &) = delete;
 
@@ -52,6 +88,12 @@ public:
 
     void run();
 
+    // Fixed timestep offscreen run, frame statistics are written once the last frame is done
+    void runHeadless();
+
+    // Headless run of every synthetic benchmark scene, the results are gathered in a single JSON file
+    void runBenchmark();
+
     void render();
 
     void handleMouseButton();
@@ -64,7 +106,7 @@ public:
 
     void createModel(const PrimitivePtr& primitive);
 
-    void takeScreenshot() const;
+    void takeScreenshot();
 
     void deletePrimitive(const PrimitivePtr &primitive);
 
@@ -0,0 +1,23 @@
+#pragma once
+
+// STD Include //
+#include <string>
+#include <vector>
+
+#include "pipeline/primitives/primitive.hpp"
+
+// Synthetic scene built from the primitive factory, every layout is deterministic so runs stay comparable
+struct BenchmarkScene {
+    std::string name;
+    int shapes = 0;
+    int pointLights = 0;
+    int models = 0;
+    int patchResolution = 20;
+
+    // Replaces the point lights of the light repository with the scene ones
+    [[nodiscard]] PrimitiveList build() const;
+
+    [[nodiscard]] std::string describe() const;
+
+    [[nodiscard]] static std::vector<BenchmarkScene> getDefaultScenes();
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+// GLM Include //
+#include <glm/glm.hpp>
+
+// STD Include //
+#include <string>
+#include <vector>
+
+#include "application/logger.hpp"
+
+struct CameraKey {
+    glm::vec3 position;
+    float yaw;
+    float pitch;
+};
+
+// One "x y z yaw pitch" key per line, keys are spread evenly over the run and interpolated linearly
+class CameraPath {
+    Logger _logger = Logger::getInstance();
+    std::vector<CameraKey> _keys;
+
+public:
+    explicit CameraPath(const std::string &path);
+
+    [[nodiscard]] bool empty() const { return _keys.empty(); }
+
+    [[nodiscard]] CameraKey sample(float progress) const;
+};
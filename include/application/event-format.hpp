@@ -0,0 +1,50 @@
+#pragma once
+
+// STD Include //
+#include <cstdint>
+
+// A log file is an EventFileHeader followed by records back to back, a record is an EventHeader, valueCount doubles
+// and a zero padded name filling the rest of its size, a zero size marks the end of the written part
+constexpr uint32_t EVENT_FILE_MAGIC = 0x474c5645;
+constexpr uint16_t EVENT_FILE_VERSION = 1;
+constexpr unsigned MAX_EVENT_VALUES = 5;
+constexpr unsigned MAX_EVENT_NAME = 48;
+
+enum EventType : uint8_t {
+    FRAME_EVENT,
+    GPU_PASS_EVENT,
+    DRAW_EVENT,
+    MEMORY_EVENT,
+    COUNTER_EVENT,
+    EVENT_TYPE_COUNT
+};
+
+constexpr const char *eventTypeNames[EVENT_TYPE_COUNT] = {"frame", "gpuPass", "draw", "memory", "counter"};
+
+// Meaning of each value of a record, in order
+constexpr const char *eventValueNames[EVENT_TYPE_COUNT][MAX_EVENT_VALUES] = {
+    {"milliseconds"},
+    {"milliseconds"},
+    {"drawCalls", "triangles", "vertices", "glCalls", "bufferBytes"},
+    {"residentKb", "peakKb"},
+    {"value"}
+};
+
+struct EventFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t segment;
+    // Wall clock of the log start in nanoseconds since the epoch, record times are relative to it
+    int64_t startTime;
+};
+
+struct EventHeader {
+    // Whole record including this header, always a multiple of 8
+    uint16_t size;
+    EventType type;
+    uint8_t valueCount;
+    uint32_t frame;
+    uint64_t time;
+};
+
+static_assert(sizeof(EventFileHeader) == 16 && sizeof(EventHeader) == 16);
@@ -0,0 +1,90 @@
+#pragma once
+
+// STD Include //
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <initializer_list>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "application/event-format.hpp"
+#include "application/logger.hpp"
+
+// Producers encode records into a memory buffer under a short lock, a background thread swaps the buffer out and
+// copies it into a memory mapped segment file, segments are rotated when full or after ROTATION_INTERVAL
+// A closed log costs a single relaxed load per record call, a writer that falls behind makes records drop
+class EventLog {
+    static constexpr size_t SEGMENT_SIZE = 64 << 20;
+    static constexpr size_t BUFFER_LIMIT = 4 << 20;
+    static constexpr std::chrono::milliseconds FLUSH_INTERVAL{20};
+    static constexpr std::chrono::milliseconds MEMORY_INTERVAL{100};
+    static constexpr std::chrono::minutes ROTATION_INTERVAL{5};
+
+    Logger _logger = Logger::getInstance();
+    std::mutex _mutex;
+    std::condition_variable _wake;
+    std::vector<std::byte> _pending;
+    size_t _dropped = 0;
+    bool _stopping = false;
+    std::atomic<bool> _open = false;
+    std::atomic<uint32_t> _frame = 0;
+    std::chrono::steady_clock::time_point _start;
+    int64_t _startTime = 0;
+    std::thread _writer;
+
+    // Only touched by the writer thread once the log is open
+    std::filesystem::path _path;
+    int _file = -1;
+    std::byte *_mapping = nullptr;
+    size_t _offset = 0;
+    uint16_t _segment = 0;
+    std::chrono::steady_clock::time_point _segmentStart;
+
+    explicit EventLog() = default;
+
+    [[nodiscard]] bool openSegment();
+
+    // Cuts the file down to what was written
+    void closeSegment();
+
+    void append(std::span<const std::byte> records);
+
+    void write();
+
+public:
+    static constexpr uint32_t CURRENT_FRAME = UINT32_MAX;
+
+    static EventLog &getInstance() {
+        static EventLog instance;
+
+        return instance;
+    }
+
+    EventLog(const EventLog &) = delete;
+
+    // Segments are named after path with their number before the extension, run.evlog gives run-0000.evlog
+    bool open(const std::filesystem::path &path);
+
+    // Writes everything recorded so far and closes the current segment
+    void close();
+
+    [[nodiscard]] bool isOpen() const { return _open.load(std::memory_order_relaxed); }
+
+    void beginFrame() { _frame.fetch_add(1, std::memory_order_relaxed); }
+
+    [[nodiscard]] uint32_t getFrame() const { return _frame.load(std::memory_order_relaxed); }
+
+    // Values past MAX_EVENT_VALUES and name characters past MAX_EVENT_NAME are cut, frame defaults to the current one
+    void record(EventType type, std::initializer_list<double> values, std::string_view name = {},
+                uint32_t frame = CURRENT_FRAME);
+
+    EventLog &operator=(const EventLog &) = delete;
+
+    ~EventLog();
+};
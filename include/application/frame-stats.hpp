@@ -0,0 +1,39 @@
+#pragma once
+
+// STD Include //
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "application/logger.hpp"
+#include "pipeline/gl-stats.hpp"
+
+struct MemoryUsage {
+    long residentKb = 0;
+    long peakKb = 0;
+};
+
+// Current and peak resident set of the process
+[[nodiscard]] MemoryUsage readMemoryUsage();
+
+class FrameStats {
+    Logger _logger = Logger::getInstance();
+    std::vector<double> _frameTimes;
+    GlCounters _glTotals;
+
+public:
+    // The GL counters of the frame are read from GlStats when it is compiled in
+    void record(double milliseconds);
+
+    [[nodiscard]] size_t getFrameCount() const { return _frameTimes.size(); }
+
+    [[nodiscard]] double getMean() const;
+
+    [[nodiscard]] double getPercentile(double ratio) const;
+
+    // Frame times, per frame GL counters when compiled in, process memory and the rolling GPU pass statistics as a
+    // JSON object, every line after the first is prefixed with indent
+    [[nodiscard]] std::string toJson(const std::string &indent = "") const;
+
+    bool write(const std::filesystem::path &path) const;
+};
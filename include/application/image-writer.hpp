@@ -0,0 +1,53 @@
+#pragma once
+
+// STD Include //
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "application/logger.hpp"
+
+// Tightly packed RGB rows in GL order, the first row is the bottom of the image
+struct ImageJob {
+    std::string filename;
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels;
+};
+
+// Encodes PNG files on a worker thread, the queue is bounded so a burst of captures holds the producer back
+// instead of piling frames up in memory
+class ImageWriter {
+    static constexpr size_t QUEUE_CAPACITY = 4;
+
+    Logger _logger = Logger::getInstance();
+    std::deque<ImageJob> _queue;
+    std::mutex _mutex;
+    std::condition_variable _jobAvailable;
+    std::condition_variable _spaceAvailable;
+    bool _stopping = false;
+    std::thread _worker;
+
+    void work();
+
+    void encode(const ImageJob &job) const;
+
+public:
+    explicit ImageWriter();
+
+    ImageWriter(const ImageWriter &) = delete;
+
+    // Blocks while the queue is full
+    void submit(ImageJob job);
+
+    ImageWriter &operator=(const ImageWriter &) = delete;
+
+    // Every queued image is still written before the worker is joined
+    ~ImageWriter();
+};
+
+using ImageWriterPtr = std::unique_ptr<ImageWriter>;
@@ -6,12 +6,28 @@
 #include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/matrix_clip_space.hpp>
 
+constexpr float POINT_LIGHT_CONSTANT = 1.0f;
+constexpr float POINT_LIGHT_LINEAR = 0.09f;
+constexpr float POINT_LIGHT_QUADRATIC = 0.032f;
+constexpr float POINT_LIGHT_CUTOFF = 5.0f / 256.0f;
+
 struct Light {
     glm::vec3 position;
     glm::vec3 direction;
     glm::vec3 color;
 };
 
+// Distance at which the attenuated intensity falls under POINT_LIGHT_CUTOFF
+inline float getPointLightRadius(const Light &light) {
+    const float intensity = glm::max(glm::max(light.color.r, light.color.g), light.color.b);
+    const float constant = POINT_LIGHT_CONSTANT - intensity / POINT_LIGHT_CUTOFF;
+    const float discriminant = POINT_LIGHT_LINEAR * POINT_LIGHT_LINEAR - 4.0f * POINT_LIGHT_QUADRATIC * constant;
+
+    if (intensity <= 0.0f || discriminant <= 0.0f)
+        return 0.0f;
+    return (-POINT_LIGHT_LINEAR + glm::sqrt(discriminant)) / (2.0f * POINT_LIGHT_QUADRATIC);
+}
+
 class LightRepository {
 public:
     static LightRepository &getInstance() {
@@ -20,22 +36,31 @@ public:
         return instance;
     }
 
-    [[nodiscard]] Light &getDirectionalLight() {
+    [[nodiscard]] const Light &getDirectionalLight() const {
         return _directionalLight;
     }
 
-    [[nodiscard]] Light &getAmbientLight() {
+    [[nodiscard]] const Light &getAmbientLight() const {
         return _ambientLight;
     }
 
-    [[nodiscard]] std::vector<Light> &getPointLights() {
+    [[nodiscard]] const std::vector<Light> &getPointLights() const {
         return _pointLights;
     }
 
-    [[nodiscard]] Light &getSpotLight() {
+    [[nodiscard]] const Light &getSpotLight() const {
         return _spotLight;
     }
 
+    // Bumped on every light change, used to skip redundant GPU uploads
+    [[nodiscard]] unsigned long getVersion() const {
+        return _version;
+    }
+
+    [[nodiscard]] unsigned long getPointLightsVersion() const {
+        return _pointLightsVersion;
+    }
+
     [[nodiscard]] glm::mat4 getDirectionalLightMatrix() const {
         const glm::mat4 lightProjection = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 0.1f, 100.0f);
         const glm::mat4 lightView = lookAt(_directionalLight.position,
@@ -45,8 +70,39 @@ public:
         return lightProjection * lightView;
     }
 
-    void addPointLight(const Light& light) {
+    void setDirectionalLight(const glm::vec3 &position, const glm::vec3 &direction) {
+        if (_directionalLight.position == position && _directionalLight.direction == direction)
+            return;
+        _directionalLight.position = position;
+        _directionalLight.direction = direction;
+        _version++;
+    }
+
+    void setSpotLight(const glm::vec3 &position, const glm::vec3 &direction) {
+        if (_spotLight.position == position && _spotLight.direction == direction)
+            return;
+        _spotLight.position = position;
+        _spotLight.direction = direction;
+        _version++;
+    }
+
+    void addPointLight(const Light &light) {
         _pointLights.push_back(light);
+        touchPointLights();
+    }
+
+    void updatePointLight(const size_t index, const Light &light) {
+        if (index >= _pointLights.size())
+            return;
+        _pointLights[index] = light;
+        touchPointLights();
+    }
+
+    void removePointLight(const size_t index) {
+        if (index >= _pointLights.size())
+            return;
+        _pointLights.erase(_pointLights.begin() + static_cast<long>(index));
+        touchPointLights();
     }
 
 private:
@@ -57,8 +113,15 @@ private:
         _spotLight = {glm::vec3(0, 0, -3), glm::vec3(0, 0, 1), glm::vec3(1.0f, 1.0f, 0.0f)};
     }
 
+    void touchPointLights() {
+        _pointLightsVersion++;
+        _version++;
+    }
+
     Light _directionalLight;
     Light _ambientLight;
     std::vector<Light> _pointLights;
     Light _spotLight;
+    unsigned long _version = 1;
+    unsigned long _pointLightsVersion = 1;
 };
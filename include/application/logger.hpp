@@ -1,7 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <format>
-#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
 
 enum LogLevel {
     TRACE, DEBUG, INFO, WARN, ERROR, CRITICAL
@@ -15,28 +20,107 @@ constexpr const char *logLevelColors[6] = {
     "\e[0;34m", "\e[0;35m", "\e[0;37m", "\e[0;33m", "\e[0;91m", "\e[1;31m"
 };
 
-class Logger {
-    LogLevel _level = TRACE;
+// Calls below this level compile to nothing, -DLOG_MIN_LEVEL=WARN strips INFO as well
+#ifndef LOG_MIN_LEVEL
+#ifdef NDEBUG
+#define LOG_MIN_LEVEL INFO
+#else
+#define LOG_MIN_LEVEL TRACE
+#endif
+#endif
+
+constexpr size_t LOG_MESSAGE_SIZE = 232;
+
+struct LogRecord {
+    std::chrono::system_clock::time_point time;
+    size_t position;
+    LogLevel level;
+    unsigned length;
+    // Whole message when it does not fit in message, owned by the record until it is written
+    std::string *overflow;
+    char message[LOG_MESSAGE_SIZE];
+};
 
-    explicit Logger() = default;
+// Bounded lock-free multi-producer ring drained by a single writer thread, callers only format their message
+// into a slot, timestamps and output happen in batches on the writer
+// A full ring drops TRACE to INFO records and makes WARN and above wait, so no error is ever lost
+class LogBackend {
+    static constexpr size_t CAPACITY = 1024;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    std::unique_ptr<Slot[]> _slots;
+    alignas(64) std::atomic<size_t> _enqueuePosition = 0;
+    alignas(64) std::atomic<size_t> _writtenPosition = 0;
+    std::atomic<size_t> _dropped = 0;
+    std::atomic<bool> _stopping = false;
+    std::thread _writer;
+
+    explicit LogBackend();
 
-    static std::string getCurrentDateTime() {
-        const time_t now = time(nullptr);
-        const tm time = *localtime(&now);
-        char buffer[80];
+    void write();
 
-        strftime(buffer, sizeof(buffer), "%Y-%m-%d.%X", &time);
-        return buffer;
+public:
+    // Trivially destructible, still readable from static destructors that run after the backend is gone
+    static inline std::atomic<bool> closed = false;
+
+    static LogBackend &getInstance() {
+        static LogBackend instance;
+
+        return instance;
     }
 
+    LogBackend(const LogBackend &) = delete;
+
+    // Claims a slot, nullptr when the record was dropped
+    [[nodiscard]] LogRecord *acquire(LogLevel level);
+
+    void publish(const LogRecord &record);
+
+    // Waits until everything published so far has been written
+    void flush();
+
+    // Synchronous path used once the writer thread is gone
+    static void writeNow(const LogRecord &record);
+
+    LogBackend &operator=(const LogBackend &) = delete;
+
+    ~LogBackend();
+};
+
+class Logger {
+    LogLevel _level = TRACE;
+
+    explicit Logger() = default;
+
     template<class... Args>
     void log(const LogLevel level, std::format_string<Args...> format, Args &&... args) const {
-        std::ostream &os = level >= ERROR ? std::cerr : std::cout;
-
         if (level < _level) return;
-        os << "[" << getCurrentDateTime() << "] ";
-        os << logLevelColors[level] << logLevelNames[level] << "\e[0m" << " ";
-        os << std::format(format, std::forward<Args>(args)...) << std::endl;
+        LogRecord local{};
+        LogRecord *record = LogBackend::closed ? &local : LogBackend::getInstance().acquire(level);
+
+        if (record == nullptr)
+            return;
+        const auto [end, size] = std::format_to_n(record->message, LOG_MESSAGE_SIZE, format,
+                                                  std::forward<Args>(args)...);
+
+        record->time = std::chrono::system_clock::now();
+        record->level = level;
+        record->length = static_cast<unsigned>(std::min<std::ptrdiff_t>(size, LOG_MESSAGE_SIZE));
+        // Long messages such as shader info logs are formatted again on the heap rather than cut
+        record->overflow = size > static_cast<std::ptrdiff_t>(LOG_MESSAGE_SIZE)
+                               ? new std::string(std::format(format, std::forward<Args>(args)...))
+                               : nullptr;
+        if (record == &local) {
+            LogBackend::writeNow(local);
+            return;
+        }
+        LogBackend::getInstance().publish(*record);
+        if (level == CRITICAL)
+            LogBackend::getInstance().flush();
     }
 
 public:
@@ -48,22 +132,26 @@ public:
 
     template<class... Args>
     void trace(std::format_string<Args...> format, Args &&... args) const {
-        log(TRACE, format, std::forward<Args>(args)...);
+        if constexpr (TRACE >= LOG_MIN_LEVEL)
+            log(TRACE, format, std::forward<Args>(args)...);
     }
 
     template<class... Args>
     void debug(std::format_string<Args...> format, Args &&... args) const {
-        log(DEBUG, format, std::forward<Args>(args)...);
+        if constexpr (DEBUG >= LOG_MIN_LEVEL)
+            log(DEBUG, format, std::forward<Args>(args)...);
     }
 
     template<class... Args>
     void info(std::format_string<Args...> format, Args &&... args) const {
-        log(INFO, format, std::forward<Args>(args)...);
+        if constexpr (INFO >= LOG_MIN_LEVEL)
+            log(INFO, format, std::forward<Args>(args)...);
     }
 
     template<class... Args>
     void warn(std::format_string<Args...> format, Args &&... args) const {
-        log(WARN, format, std::forward<Args>(args)...);
+        if constexpr (WARN >= LOG_MIN_LEVEL)
+            log(WARN, format, std::forward<Args>(args)...);
     }
 
     template<class... Args>
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+
+#include "pipeline/gl-stats.hpp"
+
+#ifdef GL_STATS_ENABLED
+
+struct ImDrawData;
+
+// Last frame GL counters per pass, docked to the right of the histogram
+class GlStatsMenu {
+    static constexpr float WIDTH = 620.0f;
+
+public:
+    GlStatsMenu() = default;
+
+    void renderMenu() const;
+
+    // ImGui goes through its own loader, its pass is rebuilt from the draw lists it submits
+    static void recordDrawData(const ImDrawData &drawData);
+};
+
+using GlStatsMenuPtr = std::unique_ptr<GlStatsMenu>;
+
+#endif
@@ -19,8 +19,14 @@ struct Folder {
     FolderPtr parent;
     std::vector<FolderPtr> subfolders;
     std::vector<PrimitivePtr> primitives;
+    // Transform node the subfolders and primitives hang from, moving the folder moves its whole subtree
+    SceneHandle node;
+    glm::vec3 position = glm::vec3(0.0f);
+    glm::vec3 rotation = glm::vec3(0.0f);
+    glm::vec3 scale = glm::vec3(1.0f);
 
     Folder(const std::string &name, FolderPtr parent = nullptr);
+    ~Folder();
 };
 
 class GraphMenu final : public LowerLateralMenu {
@@ -34,6 +40,7 @@ class GraphMenu final : public LowerLateralMenu {
 
     void renderFolder(FolderPtr folder, PrimitivePtr &selectedPrimitive);
     void renderFolderSelectionPopup(FolderPtr folder, PrimitivePtr primitive);
+    void renderFolderTransform(FolderPtr folder);
     void movePrimitiveToFolder(PrimitivePtr primitive, FolderPtr targetFolder);
     std::vector<FolderPtr> getAllFolders(FolderPtr folder);
     void updatePrimitives();
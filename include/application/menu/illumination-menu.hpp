@@ -10,9 +10,6 @@ public:
     explicit IlluminationTypeMenu();
 
     void renderMenu(Shader &textureShader) override;
-
-private:
-    int _currentModel = 4;
 };
 
 using IlluminationTypeMenuPtr = std::unique_ptr<IlluminationTypeMenu>;
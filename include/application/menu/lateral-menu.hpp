@@ -33,10 +33,11 @@ class LowerLateralMenu {
 };
 
 class TopLeftMenu {
-    static constexpr int WIDTH = 500;
     std::string _title;
 
 public:
+    static constexpr int WIDTH = 500;
+
     explicit TopLeftMenu(std::string title);
     virtual void renderMenu() = 0;
     void render();
@@ -58,7 +59,7 @@ class TopMenu {
         std::string _title;
     public:
         explicit TopMenu(std::string title);
-        virtual void renderMenu(std::vector<Light> &pointLights) = 0;
+        virtual void renderMenu(LightRepository &lightRepository) = 0;
         void render();
         virtual ~TopMenu() = default;
 };
@@ -8,7 +8,7 @@
 class LightMenu final : public TopMenu {
 public:
     explicit LightMenu();
-    void renderMenu(std::vector<Light> &pointLights) override;
+    void renderMenu(LightRepository &lightRepository) override;
 };
 
 using LightMenuPtr = std::unique_ptr<LightMenu>;
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+class ProfilerMenu {
+    static constexpr float ROW_HEIGHT = 18.0f;
+
+    std::string _exportPath = "profile-trace.json";
+    int _frameOffset = 0;
+
+    void renderTimeline() const;
+
+    void renderZoneTable() const;
+
+    static void renderGpuTable();
+
+public:
+    ProfilerMenu() = default;
+
+    void renderMenu();
+};
+
+using ProfilerMenuPtr = std::unique_ptr<ProfilerMenu>;
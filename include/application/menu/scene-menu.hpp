@@ -5,6 +5,8 @@
 struct ToneMappingSettings {
     bool  enableToneMapping = false;
     float toneMappingExposure = 1.0f;
+    bool  autoExposure = false;
+    float adaptationSpeed = 1.5f;
 
     static ToneMappingSettings &instance() {
         static ToneMappingSettings settings;
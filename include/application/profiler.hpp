@@ -0,0 +1,164 @@
+#pragma once
+
+// STD Include //
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "application/logger.hpp"
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#define PROFILE_ZONE(name) const ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+
+// Zone names are stored by pointer, they must be string literals
+struct ProfileEvent {
+    const char *name;
+    uint64_t start;
+    uint64_t end;
+    uint32_t depth;
+};
+
+struct ProfileSample {
+    ProfileEvent event;
+    uint32_t thread;
+};
+
+struct ProfileFrame {
+    uint64_t start;
+    uint64_t end;
+    std::vector<ProfileSample> samples;
+};
+
+// Single producer ring: only the owning thread pushes, the main thread drains it once per frame
+// The drained position is published back, a full ring drops new events rather than overwrite unread ones
+class ProfileRing {
+public:
+    static constexpr size_t CAPACITY = 1 << 14;
+
+private:
+    std::array<ProfileEvent, CAPACITY> _events{};
+    std::atomic<uint64_t> _head = 0;
+    std::atomic<uint64_t> _tail = 0;
+    std::atomic<uint64_t> _dropped = 0;
+
+public:
+    const uint32_t id;
+    std::string name;
+    uint32_t depth = 0;
+
+    explicit ProfileRing(uint32_t id, std::string name);
+
+    ProfileRing(const ProfileRing &) = delete;
+
+    void push(const ProfileEvent &event) {
+        const uint64_t head = _head.load(std::memory_order_relaxed);
+
+        if (head - _tail.load(std::memory_order_acquire) >= CAPACITY) {
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        _events[head & (CAPACITY - 1)] = event;
+        _head.store(head + 1, std::memory_order_release);
+    }
+
+    // Returns how many events were dropped since the last drain
+    uint64_t drain(std::vector<ProfileSample> &samples);
+
+    ProfileRing &operator=(const ProfileRing &) = delete;
+};
+
+class Profiler {
+    static constexpr size_t FRAME_HISTORY = 300;
+
+    Logger _logger = Logger::getInstance();
+    std::mutex _registryMutex;
+    std::vector<std::unique_ptr<ProfileRing>> _rings;
+    std::deque<ProfileFrame> _frames;
+    std::atomic<bool> _enabled = true;
+    bool _paused = false;
+    bool _dropReported = false;
+    uint64_t _frameStart = 0;
+    uint64_t _tickOrigin;
+    std::chrono::steady_clock::time_point _clockOrigin;
+    double _nanosecondsPerTick = 1.0;
+
+    explicit Profiler();
+
+    ProfileRing &registerThread();
+
+    void calibrate();
+
+public:
+    static Profiler &getInstance() {
+        static Profiler instance;
+
+        return instance;
+    }
+
+    // Raw TSC ticks on x86, steady clock nanoseconds elsewhere
+    [[nodiscard]] static uint64_t now();
+
+    [[nodiscard]] ProfileRing &getThreadRing();
+
+    void setThreadName(const std::string &name);
+
+    // Closes the previous frame and collects every zone recorded since, call once at the top of the frame
+    void beginFrame();
+
+    [[nodiscard]] double toMilliseconds(uint64_t ticks) const { return ticks * _nanosecondsPerTick / 1000000.0; }
+
+    [[nodiscard]] bool isEnabled() const { return _enabled.load(std::memory_order_relaxed); }
+
+    void setEnabled(const bool enabled) { _enabled.store(enabled, std::memory_order_relaxed); }
+
+    [[nodiscard]] bool isPaused() const { return _paused; }
+
+    void setPaused(const bool paused) { _paused = paused; }
+
+    [[nodiscard]] const std::deque<ProfileFrame> &getFrames() const { return _frames; }
+
+    [[nodiscard]] std::vector<std::string> getThreadNames();
+
+    // Chrome trace_event format, loadable in chrome://tracing or Perfetto
+    bool exportChromeTrace(const std::filesystem::path &path);
+
+    Profiler(const Profiler &) = delete;
+
+    void operator=(const Profiler &) = delete;
+};
+
+class ProfileZone {
+    ProfileRing *_ring = nullptr;
+    const char *_name;
+    uint64_t _start = 0;
+
+public:
+    explicit ProfileZone(const char *name) : _name(name) {
+        Profiler &profiler = Profiler::getInstance();
+
+        if (!profiler.isEnabled())
+            return;
+        _ring = &profiler.getThreadRing();
+        _ring->depth++;
+        _start = Profiler::now();
+    }
+
+    ProfileZone(const ProfileZone &) = delete;
+
+    ProfileZone &operator=(const ProfileZone &) = delete;
+
+    ~ProfileZone() {
+        if (!_ring)
+            return;
+        _ring->depth--;
+        _ring->push({_name, _start, Profiler::now(), _ring->depth});
+    }
+};
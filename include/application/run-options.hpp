@@ -0,0 +1,20 @@
+#pragma once
+
+// STD Include //
+#include <string>
+
+// Command line switches, all of them take the --name=value form
+struct RunOptions {
+    bool headless = false;
+    bool benchmark = false;
+    int frames = 600;
+    int warmupFrames = 30;
+    int captureInterval = 0;
+    std::string cameraPath;
+    std::string statsPath = "headless-stats.json";
+    std::string captureDirectory = "captures";
+    std::string recordTarget;
+    std::string eventLogPath;
+
+    [[nodiscard]] static RunOptions parse(int argc, char **argv);
+};
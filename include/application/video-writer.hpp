@@ -0,0 +1,60 @@
+#pragma once
+
+// STD Include //
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "application/image-writer.hpp"
+#include "application/logger.hpp"
+
+// Streams frames as a YUV4MPEG2 (4:2:0) sequence, either to a file or, when the target starts with '|', to the
+// standard input of a command such as "| ffmpeg -i - flythrough.mp4"
+// Frames are never dropped, a full queue holds the render loop back until the worker caught up
+class VideoWriter {
+    static constexpr size_t QUEUE_CAPACITY = 8;
+
+    Logger _logger = Logger::getInstance();
+    FILE *_output = nullptr;
+    bool _pipe = false;
+    int _width;
+    int _height;
+    std::vector<unsigned char> _planes;
+    size_t _frameCount = 0;
+    std::deque<ImageJob> _queue;
+    std::mutex _mutex;
+    std::condition_variable _frameAvailable;
+    std::condition_variable _spaceAvailable;
+    bool _stopping = false;
+    std::thread _worker;
+
+    void work();
+
+    void encode(const ImageJob &frame);
+
+public:
+    VideoWriter(const std::string &target, int width, int height, int frameRate);
+
+    VideoWriter(const VideoWriter &) = delete;
+
+    [[nodiscard]] bool isOpen() const { return _output != nullptr; }
+
+    [[nodiscard]] int getWidth() const { return _width; }
+
+    [[nodiscard]] int getHeight() const { return _height; }
+
+    // Blocks while the queue is full
+    void submit(ImageJob frame);
+
+    VideoWriter &operator=(const VideoWriter &) = delete;
+
+    // Every queued frame is still written before the output is closed
+    ~VideoWriter();
+};
+
+using VideoWriterPtr = std::unique_ptr<VideoWriter>;
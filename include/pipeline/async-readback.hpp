@@ -0,0 +1,50 @@
+#pragma once
+
+// STD Include //
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "application/image-writer.hpp"
+
+struct __GLsync;
+
+using ReadbackFunction = std::function<void(ImageJob)>;
+
+// Reads the color buffer into a ring of pixel pack buffers, a fence tells when the copy landed so the mapping
+// never stalls, the pixels are then handed over in request order
+class AsyncReadback {
+    struct Slot {
+        unsigned buffer = 0;
+        size_t capacity = 0;
+        __GLsync *fence = nullptr;
+        ImageJob job;
+    };
+
+    ReadbackFunction _consumer;
+    std::vector<Slot> _slots;
+    unsigned _next = 0;
+
+    void collect(Slot &slot);
+
+public:
+    AsyncReadback(unsigned slotCount, ReadbackFunction consumer);
+
+    AsyncReadback(const AsyncReadback &) = delete;
+
+    // Framebuffer 0 reads the back buffer, any other one its first color attachment
+    void request(unsigned framebuffer, int width, int height, std::string filename);
+
+    // Called once per frame, readbacks the GPU has not finished are left for the next call
+    void poll();
+
+    // Waits for the readbacks still in flight
+    void finish();
+
+    AsyncReadback &operator=(const AsyncReadback &) = delete;
+
+    ~AsyncReadback();
+};
+
+using AsyncReadbackPtr = std::unique_ptr<AsyncReadback>;
@@ -0,0 +1,74 @@
+#pragma once
+
+// GLM Include //
+#include <glm/glm.hpp>
+
+// STD Include //
+#include <memory>
+
+#include "application/logger.hpp"
+#include "pipeline/light-clusters.hpp"
+#include "pipeline/shader.hpp"
+#include "pipeline/shader-variants.hpp"
+
+constexpr int GBUFFER_ALBEDO_UNIT = 0;
+constexpr int GBUFFER_NORMAL_UNIT = 1;
+constexpr int GBUFFER_MATERIAL_UNIT = 2;
+constexpr int GBUFFER_DEPTH_UNIT = 3;
+constexpr int ACCUMULATION_UNIT = 4;
+
+class DeferredRenderer {
+    Logger _logger = Logger::getInstance();
+
+    int _width;
+    int _height;
+
+    unsigned _gBuffer = 0;
+    unsigned _albedoTexture = 0;
+    unsigned _normalTexture = 0;
+    unsigned _materialTexture = 0;
+    unsigned _depthTexture = 0;
+
+    unsigned _accumulationBuffer = 0;
+    unsigned _accumulationTexture = 0;
+
+    unsigned _screenVAO = 0;
+    unsigned _sphereVAO = 0;
+    unsigned _sphereVBO = 0;
+    unsigned _sphereEBO = 0;
+    int _sphereIndexCount = 0;
+
+    ShaderVariants _lightingShaders;
+    Shader _volumeShader;
+    Shader _compositeShader;
+
+    void createGBuffer();
+
+    void createAccumulationBuffer();
+
+    void createSphere();
+
+    void bindGBuffer(const Shader &shader) const;
+
+    void checkFramebuffer(const char *name) const;
+
+public:
+    explicit DeferredRenderer(int width, int height);
+
+    DeferredRenderer(const DeferredRenderer &) = delete;
+
+    void beginGeometryPass() const;
+
+    void renderLighting(const LightClusters &lightClusters, const glm::mat4 &view, const glm::mat4 &projection,
+                        int illuminationModel);
+
+    void composite();
+
+    unsigned reloadShaders(const std::vector<std::string> &files);
+
+    DeferredRenderer &operator=(const DeferredRenderer &) = delete;
+
+    ~DeferredRenderer();
+};
+
+using DeferredRendererPtr = std::unique_ptr<DeferredRenderer>;
@@ -0,0 +1,47 @@
+#pragma once
+
+// STD Include //
+#include <array>
+#include <memory>
+
+#include "pipeline/async-readback.hpp"
+
+struct FrameHistogramData {
+    std::array<int, 256> luminance{};
+    std::array<int, 256> red{};
+    std::array<int, 256> green{};
+    std::array<int, 256> blue{};
+    int pixelCount = 0;
+};
+
+// Histograms of the rendered frame, the frame is blitted into a small texture whose mip chain box filters it
+// and a low mip is read back asynchronously, the data lags the screen by a couple of frames
+class FrameHistogram {
+    static constexpr int WIDTH = 1024;
+    static constexpr int HEIGHT = 576;
+    static constexpr int READ_LEVEL = 2;
+
+    unsigned _texture = 0;
+    unsigned _blitFramebuffer = 0;
+    unsigned _readFramebuffer = 0;
+    AsyncReadback _readback;
+    FrameHistogramData _data;
+
+    void reduce(const ImageJob &job);
+
+public:
+    explicit FrameHistogram();
+
+    FrameHistogram(const FrameHistogram &) = delete;
+
+    // Framebuffer is bound again once its color buffer has been downsampled
+    void capture(unsigned framebuffer, int width, int height);
+
+    [[nodiscard]] const FrameHistogramData &getData() const { return _data; }
+
+    FrameHistogram &operator=(const FrameHistogram &) = delete;
+
+    ~FrameHistogram();
+};
+
+using FrameHistogramPtr = std::unique_ptr<FrameHistogram>;
@@ -0,0 +1,116 @@
+#pragma once
+
+// STD Include //
+#include <array>
+#include <cstdint>
+
+#include "application/profiler.hpp"
+
+// Release builds (NDEBUG) drop the collector, no GL call is wrapped and the pass scopes expand to nothing
+#ifndef NDEBUG
+#define GL_STATS_ENABLED
+#endif
+
+struct GlCounters {
+    uint64_t glCalls = 0;
+    uint64_t drawCalls = 0;
+    uint64_t vertices = 0;
+    uint64_t triangles = 0;
+    uint64_t programBinds = 0;
+    uint64_t textureBinds = 0;
+    uint64_t vertexArrayBinds = 0;
+    uint64_t uniformUploads = 0;
+    uint64_t bufferBytes = 0;
+
+    void add(const GlCounters &other) {
+        glCalls += other.glCalls;
+        drawCalls += other.drawCalls;
+        vertices += other.vertices;
+        triangles += other.triangles;
+        programBinds += other.programBinds;
+        textureBinds += other.textureBinds;
+        vertexArrayBinds += other.vertexArrayBinds;
+        uniformUploads += other.uniformUploads;
+        bufferBytes += other.bufferBytes;
+    }
+};
+
+enum GlPass {
+    SHADOW_PASS,
+    DEPTH_PASS,
+    SKYBOX_PASS,
+    MAIN_PASS,
+    POST_PASS,
+    SELECTION_PASS,
+    UI_PASS,
+    OTHER_PASS,
+    GL_PASS_COUNT
+};
+
+constexpr const char *glPassNames[GL_PASS_COUNT] = {"Shadow", "Depth pre-pass", "Skybox", "Main", "Post", "Selection",
+                                                    "UI", "Other"};
+
+using GlPassCounters = std::array<GlCounters, GL_PASS_COUNT>;
+
+#ifdef GL_STATS_ENABLED
+
+#define GL_STATS_PASS(pass) const GlStatsPass PROFILE_CONCAT(glStatsPass, __LINE__)(pass)
+
+// Counts the calls going through the glad loader by wrapping its function pointers, ImGui has its own loader so
+// its pass is filled from the draw data instead
+class GlStats {
+    GlPassCounters _frame{};
+    GlPassCounters _lastFrame{};
+    GlPass _pass = OTHER_PASS;
+    bool _installed = false;
+
+    explicit GlStats() = default;
+
+public:
+    static GlStats &getInstance() {
+        static GlStats instance;
+
+        return instance;
+    }
+
+    // Must run after gladLoadGLLoader, the wrappers capture the loaded pointers
+    void install();
+
+    // Moves the counters of the frame that just ended to the last frame slot
+    void beginFrame();
+
+    // Returns the pass that was active so scopes can nest
+    GlPass setPass(GlPass pass);
+
+    void add(const GlPass pass, const GlCounters &counters) { _frame[pass].add(counters); }
+
+    [[nodiscard]] GlCounters getCurrentFrameTotal() const;
+
+    [[nodiscard]] const GlPassCounters &getCurrentFrame() const { return _frame; }
+
+    [[nodiscard]] const GlPassCounters &getLastFrame() const { return _lastFrame; }
+
+    GlStats(const GlStats &) = delete;
+
+    void operator=(const GlStats &) = delete;
+};
+
+class GlStatsPass {
+    GlPass _previous;
+
+public:
+    explicit GlStatsPass(const GlPass pass) : _previous(GlStats::getInstance().setPass(pass)) {
+    }
+
+    GlStatsPass(const GlStatsPass &) = delete;
+
+    GlStatsPass &operator=(const GlStatsPass &) = delete;
+
+    ~GlStatsPass() { GlStats::getInstance().setPass(_previous); }
+};
+
+#else
+
+#define GL_STATS_PASS(pass)
+
+#endif
@@ -0,0 +1,91 @@
+#pragma once
+
+// STD Include //
+#include <array>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "application/profiler.hpp"
+
+#define PROFILE_GPU_ZONE(name) const GpuZone PROFILE_CONCAT(gpuZone, __LINE__)(name)
+
+struct GpuZoneStats {
+    float last = 0.0f;
+    float average = 0.0f;
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    size_t samples = 0;
+};
+
+// Timestamp queries are read back FRAME_LATENCY frames later, a frame the GPU has not finished is dropped
+// rather than waited on
+class GpuProfiler {
+    static constexpr unsigned FRAME_LATENCY = 4;
+    static constexpr unsigned MAX_ZONES = 32;
+    static constexpr size_t HISTORY = 240;
+
+    struct FrameQueries {
+        std::array<unsigned, MAX_ZONES * 2> queries{};
+        std::array<const char *, MAX_ZONES> names{};
+        unsigned count = 0;
+        uint32_t frame = 0;
+        bool submitted = false;
+    };
+
+    std::array<FrameQueries, FRAME_LATENCY> _frames{};
+    std::map<std::string, std::deque<float>> _history;
+    std::map<std::string, float> _last;
+    unsigned _current = 0;
+    unsigned _dropped = 0;
+    bool _initialized = false;
+    bool _active = false;
+
+    explicit GpuProfiler() = default;
+
+    void collect(FrameQueries &frame);
+
+public:
+    static GpuProfiler &getInstance() {
+        static GpuProfiler instance;
+
+        return instance;
+    }
+
+    void beginFrame();
+
+    [[nodiscard]] unsigned beginZone(const char *name);
+
+    void endZone(unsigned zone);
+
+    [[nodiscard]] std::vector<std::pair<std::string, GpuZoneStats>> getStats() const;
+
+    [[nodiscard]] unsigned getDroppedFrames() const { return _dropped; }
+
+    // Starts the rolling statistics over, queries already in flight still land in the new history
+    void resetHistory() {
+        _history.clear();
+        _last.clear();
+        _dropped = 0;
+    }
+
+    GpuProfiler(const GpuProfiler &) = delete;
+
+    void operator=(const GpuProfiler &) = delete;
+};
+
+class GpuZone {
+    unsigned _zone;
+
+public:
+    explicit GpuZone(const char *name) : _zone(GpuProfiler::getInstance().beginZone(name)) {
+    }
+
+    GpuZone(const GpuZone &) = delete;
+
+    GpuZone &operator=(const GpuZone &) = delete;
+
+    ~GpuZone() { GpuProfiler::getInstance().endZone(_zone); }
+};
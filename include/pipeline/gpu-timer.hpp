@@ -0,0 +1,34 @@
+#pragma once
+
+// STD Include //
+#include <array>
+#include <memory>
+
+// Results are read a few frames late so the CPU never waits on the GPU
+class GpuTimer {
+    static constexpr unsigned QUERY_COUNT = 3;
+
+    std::array<unsigned, QUERY_COUNT> _queries{};
+    std::array<bool, QUERY_COUNT> _pending{};
+    unsigned _current = 0;
+    float _milliseconds = 0.0f;
+
+    void collect();
+
+public:
+    explicit GpuTimer();
+
+    GpuTimer(const GpuTimer &) = delete;
+
+    void begin();
+
+    void end();
+
+    [[nodiscard]] float getMilliseconds() const { return _milliseconds; }
+
+    GpuTimer &operator=(const GpuTimer &) = delete;
+
+    ~GpuTimer();
+};
+
+using GpuTimerPtr = std::unique_ptr<GpuTimer>;
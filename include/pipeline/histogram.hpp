@@ -6,18 +6,27 @@
 #include <imgui.h>
 
 #include "application/menu/lateral-menu.hpp"
+#include "pipeline/frame-histogram.hpp"
 #include "window/window.hpp"
 
 class Histogram : public TopLeftMenu {
     Window &_window;
+    const FrameHistogram &_frameHistogram;
     std::string _imagePath;
     std::array<int, 256> _grayscaleHistogram{};
     char _inputBuffer[512] = "";
 
 public:
-    explicit Histogram(Window &window, const std::string &imagePath = "resources/textures/sample.png");
+    explicit Histogram(Window &window, const FrameHistogram &frameHistogram,
+                       const std::string &imagePath = "resources/textures/sample.png");
     void renderMenu() override;
+    void renderFrameHistogram() const;
     void compute();
+
+    // Pure CPU, 1 and 2 channel images are read as grey, the alpha channel is ignored
+    // Large images are split in row strips counted on separate threads
+    [[nodiscard]] static std::array<int, 256> computeGrayscale(const unsigned char *data, int width, int height,
+                                                               int channels);
 };
 
 using HistogramPtr = std::unique_ptr<Histogram>;
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+// GLM Include //
+#include <glm/glm.hpp>
+
+// STD Include //
+#include <memory>
+
+#include "application/light-repository.hpp"
+
+// std140 mirror of the "Lights" uniform block declared in shaders/lib/lights.glsl
+struct LightBlock {
+    glm::mat4 lightSpaceMatrix;
+    glm::vec3 lightDir;
+    float cutOff;
+    glm::vec3 lightColor;
+    float outerCutOff;
+    glm::vec3 ambientColor;
+    float padding0;
+    glm::vec3 spotPos;
+    float padding1;
+    glm::vec3 spotDir;
+    float padding2;
+};
+
+static_assert(sizeof(LightBlock) == 144, "LightBlock must match the std140 layout of the Lights block");
+
+class LightBuffer {
+    unsigned _ubo = 0;
+    unsigned long _version = 0;
+
+public:
+    explicit LightBuffer();
+
+    LightBuffer(const LightBuffer &) = delete;
+
+    void sync(const LightRepository &lightRepository);
+
+    LightBuffer &operator=(const LightBuffer &) = delete;
+
+    ~LightBuffer();
+};
+
+using LightBufferPtr = std::unique_ptr<LightBuffer>;
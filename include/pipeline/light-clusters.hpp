@@ -0,0 +1,78 @@
+#pragma once
+
+// GLM Include //
+#include <glm/glm.hpp>
+
+// STD Include //
+#include <memory>
+#include <vector>
+
+#include "application/light-repository.hpp"
+#include "application/logger.hpp"
+#include "pipeline/shader.hpp"
+
+constexpr unsigned CLUSTER_X = 16;
+constexpr unsigned CLUSTER_Y = 9;
+constexpr unsigned CLUSTER_Z = 24;
+constexpr unsigned CLUSTER_COUNT = CLUSTER_X * CLUSTER_Y * CLUSTER_Z;
+
+constexpr int CLUSTER_GRID_UNIT = 27;
+constexpr int CLUSTER_INDICES_UNIT = 28;
+constexpr int CLUSTER_LIGHTS_UNIT = 29;
+
+class LightClusters {
+    Logger _logger = Logger::getInstance();
+
+    unsigned _gridBuffer = 0;
+    unsigned _gridTexture = 0;
+    unsigned _indexBuffer = 0;
+    unsigned _indexTexture = 0;
+    unsigned _lightBuffer = 0;
+    unsigned _lightTexture = 0;
+    int _maxTexels = 0;
+    unsigned long _lightsVersion = 0;
+    size_t _lightCount = 0;
+    bool _overflowReported = false;
+    bool _truncationReported = false;
+
+    float _near = 0.1f;
+    float _far = 100.0f;
+    glm::vec2 _screenSize{1.0f};
+
+    std::vector<unsigned> _grid;
+    std::vector<unsigned> _indices;
+    std::vector<unsigned> _cursor;
+    std::vector<glm::vec4> _lights;
+
+    [[nodiscard]] float getSliceDepth(unsigned slice) const;
+
+    template<typename Visitor>
+    void visitClusters(const glm::vec3 &center, float radius, const glm::mat4 &projection,
+                       Visitor &&visitor) const;
+
+    void uploadLights() const;
+
+    void uploadClusters() const;
+
+public:
+    explicit LightClusters();
+
+    LightClusters(const LightClusters &) = delete;
+
+    void syncLights(const LightRepository &lightRepository);
+
+    void update(const LightRepository &lightRepository, const glm::mat4 &view, const glm::mat4 &projection,
+                float near, float far, const glm::vec2 &screenSize);
+
+    void bindLights(const Shader &shader) const;
+
+    void bind(const Shader &shader) const;
+
+    [[nodiscard]] size_t getLightCount() const { return _lightCount; }
+
+    LightClusters &operator=(const LightClusters &) = delete;
+
+    ~LightClusters();
+};
+
+using LightClustersPtr = std::unique_ptr<LightClusters>;
@@ -45,6 +45,8 @@ public:
 
     void renderDepth(const Shader &shader) override;
 
+    [[nodiscard]] unsigned getShaderFeatures() const override;
+
     void disableNormalMapping();
 
     ~Model() override = default;
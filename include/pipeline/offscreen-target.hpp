@@ -0,0 +1,34 @@
+#pragma once
+
+// STD Include //
+#include <memory>
+
+#include "application/logger.hpp"
+
+// Colour and depth renderbuffers standing in for the default framebuffer when nothing is presented
+class OffscreenTarget {
+    Logger _logger = Logger::getInstance();
+
+    int _width;
+    int _height;
+    unsigned _framebuffer = 0;
+    unsigned _colorBuffer = 0;
+    unsigned _depthBuffer = 0;
+
+public:
+    explicit OffscreenTarget(int width, int height);
+
+    OffscreenTarget(const OffscreenTarget &) = delete;
+
+    [[nodiscard]] unsigned getFramebuffer() const { return _framebuffer; }
+
+    [[nodiscard]] int getWidth() const { return _width; }
+
+    [[nodiscard]] int getHeight() const { return _height; }
+
+    OffscreenTarget &operator=(const OffscreenTarget &) = delete;
+
+    ~OffscreenTarget();
+};
+
+using OffscreenTargetPtr = std::unique_ptr<OffscreenTarget>;
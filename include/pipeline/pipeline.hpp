@@ -2,6 +2,13 @@
 
 // Header File Include //
 #include "pipeline/primitives/primitive.hpp"
+#include "pipeline/deferred-renderer.hpp"
+#include "pipeline/frame-histogram.hpp"
+#include "pipeline/gpu-timer.hpp"
+#include "pipeline/light-buffer.hpp"
+#include "pipeline/light-clusters.hpp"
+#include "pipeline/post-processor.hpp"
+#include "pipeline/shader-watcher.hpp"
 
 // STD Include //
 #include <vector>
@@ -17,10 +24,32 @@ class Pipeline {
     unsigned int _cubeMapTexture;
     GLuint _depthFBO;
     unsigned _shadow = 0;
+    LightClustersPtr _lightClusters;
+    LightBufferPtr _lightBuffer;
+    DeferredRendererPtr _deferredRenderer;
+    GpuTimerPtr _depthPrePassTimer;
+    GpuTimerPtr _shadingPassTimer;
+    ShaderWatcherPtr _shaderWatcher;
+    FrameHistogramPtr _frameHistogram;
+    PostProcessorPtr _postProcessor;
+    double _lastTime = 0.0;
+    std::vector<std::pair<float, Primitive *>> _drawOrder;
+    unsigned _targetFramebuffer = 0;
+    int _targetWidth = 0;
+    int _targetHeight = 0;
 
-    std::vector<glm::vec3> transformAABB(const glm::mat4 &model, const glm::vec3 &localMin, const glm::vec3 &localMax);
+    void reloadShaders();
 
-    AABB computeWorldAABB(const glm::mat4 &modelMatrix, const AABB &box);
+    void bindTargetFramebuffer() const;
+
+    // Culls the scene store against the camera and orders what is left by view depth
+    void sortFrontToBack(const glm::mat4 &view, const glm::mat4 &projection);
+
+    void renderDepthPrePass(const glm::mat4 &view, const glm::mat4 &projection);
+
+    void renderForward(const glm::mat4 &view, const glm::mat4 &projection);
+
+    void renderDeferred(const glm::mat4 &view, const glm::mat4 &projection);
 
 public:
     Pipeline();
@@ -29,7 +58,16 @@ public:
 
     void initializeImgui();
 
-    void render(const PrimitiveList &primitives, const glm::mat4 &view, const glm::mat4 &projection) const;
+    void prepareShaders(const PrimitiveList &primitives) const;
+
+    // Draws every active primitive of the scene store
+    void render(const glm::mat4 &view, const glm::mat4 &projection);
+
+    // Final image destination and its size, 0 targets the window back buffer which is measured every frame instead
+    void setTargetFramebuffer(unsigned framebuffer, int width = 0, int height = 0);
+
+    // Plotted by the histogram menu, auto-exposure meters the HDR target on the GPU rather than this tone mapped output
+    [[nodiscard]] const FrameHistogram &getFrameHistogram() const { return *_frameHistogram; }
 
     ~Pipeline() = default;
 
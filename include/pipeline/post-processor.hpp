@@ -0,0 +1,78 @@
+#pragma once
+
+// STD Include //
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "application/logger.hpp"
+#include "pipeline/shader.hpp"
+
+constexpr int HDR_COLOR_UNIT = 0;
+constexpr int HDR_DEPTH_UNIT = 1;
+constexpr int EXPOSURE_UNIT = 2;
+constexpr int LUMINANCE_UNIT = 3;
+constexpr int FILTER_MASK_UNIT = 4;
+
+// The scene is lit into a half float target, filters, exposure and tone mapping are applied once per pixel in a
+// fullscreen pass, objects only tag their pixels with their filter in a second attachment
+// Auto-exposure averages log luminance through a mip chain and adapts on the GPU, nothing is read back
+class PostProcessor {
+    static constexpr int LUMINANCE_WIDTH = 256;
+    static constexpr int LUMINANCE_HEIGHT = 128;
+    static constexpr int LUMINANCE_LEVELS = 9;
+
+    Logger _logger = Logger::getInstance();
+
+    int _width;
+    int _height;
+
+    unsigned _sceneFramebuffer = 0;
+    unsigned _colorTexture = 0;
+    unsigned _depthTexture = 0;
+    unsigned _filterMaskTexture = 0;
+
+    unsigned _luminanceFramebuffer = 0;
+    unsigned _luminanceTexture = 0;
+
+    // Ping-pong 1x1 targets, each frame adapts from the previous exposure
+    unsigned _exposureFramebuffers[2]{};
+    unsigned _exposureTextures[2]{};
+    unsigned _currentExposure = 0;
+
+    unsigned _screenVAO = 0;
+
+    Shader _luminanceShader;
+    Shader _exposureShader;
+    Shader _postShader;
+
+    void createSceneFramebuffer();
+
+    void createExposureTargets();
+
+    void checkFramebuffer(const char *name) const;
+
+public:
+    explicit PostProcessor(int width, int height);
+
+    PostProcessor(const PostProcessor &) = delete;
+
+    // Binds the HDR target, clearing it with the current clear color and the filter mask to no filter
+    void beginScene() const;
+
+    void bindSceneFramebuffer() const;
+
+    // Leaves the viewport set to the luminance target, the caller restores its own
+    void updateExposure(float deltaTime);
+
+    // Draws into the bound framebuffer and writes the scene depth back for the passes drawn on top
+    void resolve() const;
+
+    unsigned reloadShaders(const std::vector<std::string> &files);
+
+    PostProcessor &operator=(const PostProcessor &) = delete;
+
+    ~PostProcessor();
+};
+
+using PostProcessorPtr = std::unique_ptr<PostProcessor>;
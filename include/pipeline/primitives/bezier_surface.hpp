@@ -15,12 +15,16 @@ class BezierSurface final : public Primitive {
     glm::vec3 _minSize = glm::vec3(std::numeric_limits<float>::max());
     glm::vec3 _maxSize = glm::vec3(std::numeric_limits<float>::lowest());
 
-    void generateMesh();
-    glm::vec3 evaluate(float u, float v) const;
-    glm::vec3 bernstein(float t, const glm::vec3* points) const;
+    void updateMesh();
+    static glm::vec3 evaluate(const glm::vec3 (&controlPoints)[4][4], float u, float v);
+    static glm::vec3 bernstein(float t, const glm::vec3* points);
 
 public:
     BezierSurface();
+
+    // Pure CPU, fills bounds with the extent of the generated patch
+    [[nodiscard]] static std::vector<float> generateMesh(const glm::vec3 (&controlPoints)[4][4], int resolutionU,
+                                                         int resolutionV, AABB &bounds);
     [[nodiscard]] AABB getLocalBox() const override;
 
     void setResolution(int u, int v);
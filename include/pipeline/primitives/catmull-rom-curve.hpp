@@ -16,11 +16,15 @@ class CatmullRomCurve final : public Primitive {
     std::vector<float> _vertices;
     int _resolution = 20;
 
-    void generateCurve();
+    void updateCurve();
 
 public:
     CatmullRomCurve();
 
+    // Pure CPU, a tube around the spline, indices describe its triangles
+    [[nodiscard]] static std::vector<float> generateCurve(const std::vector<glm::vec3> &controlPoints, int resolution,
+                                                          std::vector<unsigned> &indices, AABB &bounds);
+
     void setControlPoints(const std::vector<glm::vec3>& points);
     void setResolution(int resolution);
 
@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "pipeline/scene-store.hpp"
 #include "pipeline/selection/selectable.hpp"
 #include "pipeline/selection/intersection.hpp"
 
@@ -24,10 +25,12 @@ enum PrimitiveType {
 
 constexpr std::string primitiveTypeNames[8] = {"Cube", "Plane", "Cylinder", "Cone", "Sphere", "Model", "Bezier Surface", "Catmull-Rom"};
 
-class Primitive : public Selectable {
+// Menu facing facade, the transform, bounds and material live in the SceneStore entry behind _handle
+class Primitive : public Selectable, public std::enable_shared_from_this<Primitive> {
 protected:
     Logger _logger = Logger::getInstance();
-    Shader &_shader;
+    SceneHandle _handle;
+    Shader *_shader;
     unsigned _texture = 0;
 
     FloatPropertyPtr _positionX;
@@ -52,11 +55,6 @@ protected:
     FloatPropertyPtr _metallicProperty;
     IntPropertyPtr _filterProperty;
 
-    float _roughness = 0.99f;
-    float _metallic = 0.2f;
-    glm::vec3 _color = glm::vec3(0);
-    int _filterType = 0;
-
     bool _disableNormalMapping = false;
 
     void initializePositionProperties();
@@ -67,13 +65,26 @@ protected:
 
     void setTransformation(glm::vec3 position, glm::vec3 rotation, glm::vec3 scale);
 
+    void setLocalModel(const glm::mat4 &model) { SceneStore::getInstance().setLocal(_handle, model); }
+
+    [[nodiscard]] const glm::mat4 &getLocalModel() const { return SceneStore::getInstance().getLocal(_handle); }
+
+    [[nodiscard]] SceneMaterial &getMaterial() { return SceneStore::getInstance().getMaterial(_handle); }
+
+    // Has the local box read again, for meshes regenerated after construction
+    void markGeometryChanged() { SceneStore::getInstance().setFlag(_handle, SCENE_GEOMETRY_DIRTY, true); }
+
 public:
     explicit Primitive(Shader &shader, Shader &glowShader);
 
+    Primitive(const Primitive &) = delete;
+
     virtual void render(const glm::mat4 &view, const glm::mat4 &projection);
 
     virtual void renderDepth(const Shader &shader);
 
+    [[nodiscard]] virtual unsigned getShaderFeatures() const;
+
     virtual void translate(const glm::vec3 &translation);
 
     virtual void rotate(float degrees, const glm::vec3 &axis);
@@ -84,12 +95,27 @@ public:
 
     void loadTexture(const std::string &texturePath);
 
+    // Position, rotation and scale are relative to the parent
     [[nodiscard]] glm::vec3 getPosition() const;
 
     [[nodiscard]] glm::vec3 getRotation() const;
 
     [[nodiscard]] glm::vec3 getScale() const;
 
+    [[nodiscard]] const glm::mat4 &getModel() const override { return SceneStore::getInstance().getModel(_handle); }
+
+    [[nodiscard]] SceneHandle getHandle() const { return _handle; }
+
+    // Attaches the primitive below another scene entry without moving it in the world
+    bool setParent(SceneHandle parent);
+
+    [[nodiscard]] AABB getCollisionBox() const { return SceneStore::getInstance().getWorldBox(_handle); }
+
+    [[nodiscard]] glm::vec3 getColor() const { return SceneStore::getInstance().getMaterial(_handle).color; }
+
+    // Inactive primitives stay alive but are skipped by rendering and picking
+    void setActive(bool active) { SceneStore::getInstance().setFlag(_handle, SCENE_ACTIVE, active); }
+
     void setRoughness(float roughness);
 
     void setMetallic(float metallic);
@@ -97,6 +123,10 @@ public:
     void setColor(glm::vec3 color);
 
     void applyFilter(int filterType);
+
+    Primitive &operator=(const Primitive &) = delete;
+
+    ~Primitive() override;
 };
 
 using PrimitivePtr = std::shared_ptr<Primitive>;
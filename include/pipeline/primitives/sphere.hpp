@@ -17,11 +17,12 @@ class Sphere final : public Primitive {
 
     void updateTopology();
 
-    void generateMesh();
-
 public:
     explicit Sphere(float radius);
 
+    // Pure CPU, interleaved position, uv, normal and tangent for every triangle
+    [[nodiscard]] static std::vector<float> generateMesh(float radius, unsigned sectorCount, unsigned stackCount);
+
     void render(const glm::mat4 &view, const glm::mat4 &projection) override;
 
     void renderDepth(const Shader &shader) override;
@@ -0,0 +1,57 @@
+#pragma once
+
+// STD Include //
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+#include "application/logger.hpp"
+
+// Linked programs are stored per driver, a source or driver change simply misses the cache
+// The directory is capped at SIZE_LIMIT, the least recently used binaries are evicted at startup
+class ProgramCache {
+    static constexpr uintmax_t SIZE_LIMIT = 32 << 20;
+
+    Logger _logger = Logger::getInstance();
+    std::filesystem::path _directory = "cache/shaders";
+    std::string _driver;
+    bool _initialized = false;
+    bool _supported = false;
+
+    unsigned _hits = 0;
+    unsigned _misses = 0;
+    double _loadTime = 0.0;
+    double _compileTime = 0.0;
+
+    explicit ProgramCache() = default;
+
+    void initialize();
+
+    void evict() const;
+
+public:
+    static ProgramCache &getInstance() {
+        static ProgramCache instance;
+
+        return instance;
+    }
+
+    [[nodiscard]] std::string makeKey(const std::string &vertexSource, const std::string &fragmentSource);
+
+    [[nodiscard]] bool load(unsigned program, const std::string &key);
+
+    void store(unsigned program, const std::string &key);
+
+    // Drops the binary of a key no longer produced, such as the previous version of a reloaded shader
+    void remove(const std::string &key) const;
+
+    void recordLoad(double milliseconds);
+
+    void recordCompile(double milliseconds);
+
+    void report() const;
+
+    ProgramCache(const ProgramCache &) = delete;
+
+    void operator=(const ProgramCache &) = delete;
+};
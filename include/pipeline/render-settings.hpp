@@ -0,0 +1,26 @@
+#pragma once
+
+struct RenderSettings {
+    int illuminationModel = 4;
+    bool deferredShading = false;
+    bool depthPrePass = false;
+    bool liveHistogram = false;
+    bool frustumCulling = true;
+
+    static RenderSettings &instance() {
+        static RenderSettings settings;
+        return settings;
+    }
+};
+
+struct RenderStats {
+    float depthPrePassTime = 0.0f;
+    float shadingPassTime = 0.0f;
+    unsigned visiblePrimitives = 0;
+    unsigned scenePrimitives = 0;
+
+    static RenderStats &instance() {
+        static RenderStats stats;
+        return stats;
+    }
+};
@@ -0,0 +1,146 @@
+#pragma once
+
+// GLM Include //
+#include <glm/glm.hpp>
+
+// STD Include //
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "pipeline/selection/intersection.hpp"
+
+enum SceneFlag : uint8_t {
+    SCENE_ACTIVE = 1 << 0,
+    // The transform changed, the world box is recomputed from the cached local box
+    SCENE_BOUNDS_DIRTY = 1 << 1,
+    // The geometry changed, the local box is fetched again from the primitive
+    SCENE_GEOMETRY_DIRTY = 1 << 2,
+    SCENE_VISIBLE = 1 << 3,
+    SCENE_SHADOW_VISIBLE = 1 << 4,
+    // The local transform changed, the world one is recomputed on the next transform update
+    SCENE_TRANSFORM_DIRTY = 1 << 5,
+    // Set by the transform update on entries whose world transform it recomputed, so their children follow
+    SCENE_WORLD_CHANGED = 1 << 6
+};
+
+struct SceneMaterial {
+    glm::vec3 color = glm::vec3(0.0f);
+    float roughness = 0.99f;
+    float metallic = 0.2f;
+    int filterType = 0;
+};
+
+struct SceneHandle {
+    uint32_t slot = UINT32_MAX;
+    uint32_t generation = 0;
+};
+
+// Transforms, bounds and materials of every primitive in dense parallel arrays that culling, sorting and picking
+// walk linearly, removal swaps the last entry in so handles go through a slot table that follows it
+// Entries form a transform hierarchy, world matrices are recomputed in one batch ordered by depth, and only below
+// the entries whose local transform changed
+class SceneStore {
+    static constexpr uint32_t NO_PARENT = UINT32_MAX;
+
+    struct Slot {
+        uint32_t dense = 0;
+        uint32_t generation = 0;
+    };
+
+    std::vector<glm::mat4> _locals;
+    std::vector<glm::mat4> _models;
+    // Slot of the parent entry, the slot stays valid when the parent moves in the dense arrays
+    std::vector<uint32_t> _parents;
+    std::vector<AABB> _localBoxes;
+    std::vector<AABB> _worldBoxes;
+    std::vector<SceneMaterial> _materials;
+    std::vector<Primitive *> _geometries;
+    std::vector<uint8_t> _flags;
+    std::vector<uint32_t> _slotOf;
+    std::vector<Slot> _slots;
+    std::vector<uint32_t> _freeSlots;
+
+    // Dense indices sorted by depth, level n spans _order[_levelStarts[n]] to _order[_levelStarts[n + 1]]
+    std::vector<uint32_t> _order;
+    std::vector<size_t> _levelStarts;
+    bool _orderDirty = false;
+    bool _transformsDirty = false;
+
+    explicit SceneStore() = default;
+
+    [[nodiscard]] uint32_t indexOf(const SceneHandle handle) const { return _slots[handle.slot].dense; }
+
+    void rebuildOrder();
+
+    void updateTransforms(size_t begin, size_t end);
+
+    void updateBounds(uint32_t index);
+
+public:
+    static SceneStore &getInstance() {
+        static SceneStore instance;
+
+        return instance;
+    }
+
+    SceneStore(const SceneStore &) = delete;
+
+    // New entries are active root entries with an identity transform, their bounds are resolved on the next update
+    // Without geometry the entry is a transform node that is never active, only there to carry its children
+    [[nodiscard]] SceneHandle create(Primitive *geometry);
+
+    // Children of the entry are handed to its parent with their world transform unchanged
+    void destroy(SceneHandle handle);
+
+    [[nodiscard]] bool isValid(const SceneHandle handle) const {
+        return handle.slot < _slots.size() && _slots[handle.slot].generation == handle.generation;
+    }
+
+    // World transform as of the last transform update
+    [[nodiscard]] const glm::mat4 &getModel(const SceneHandle handle) const { return _models[indexOf(handle)]; }
+
+    [[nodiscard]] const glm::mat4 &getLocal(const SceneHandle handle) const { return _locals[indexOf(handle)]; }
+
+    // Transform relative to the parent
+    void setLocal(SceneHandle handle, const glm::mat4 &local);
+
+    // Keeps the world transform of child, an invalid parent makes it a root entry, returns false and changes
+    // nothing when parent is child or one of its descendants
+    bool setParent(SceneHandle child, SceneHandle parent);
+
+    [[nodiscard]] SceneMaterial &getMaterial(const SceneHandle handle) { return _materials[indexOf(handle)]; }
+
+    [[nodiscard]] const SceneMaterial &getMaterial(const SceneHandle handle) const {
+        return _materials[indexOf(handle)];
+    }
+
+    void setFlag(SceneHandle handle, SceneFlag flag, bool enabled);
+
+    // Recomputes the world transform of the dirty entries and of everything below them, level by level, entries of
+    // a large level are split over several threads since they only read the level above
+    void updateTransforms();
+
+    // World box of one entry, brought up to date first when it is dirty
+    [[nodiscard]] AABB getWorldBox(SceneHandle handle);
+
+    // Updates the transforms, then recomputes the world boxes of every dirty entry
+    void updateBounds();
+
+    // Sets flag on the active entries whose world box touches the frustum of viewProjection, clears it on the
+    // others, returns how many got it, bounds are expected to be up to date
+    size_t cull(const glm::mat4 &viewProjection, SceneFlag flag);
+
+    // Sets flag on every active entry, clears it on the others
+    void markAll(SceneFlag flag);
+
+    [[nodiscard]] size_t size() const { return _models.size(); }
+
+    [[nodiscard]] std::span<const AABB> getWorldBoxes() const { return _worldBoxes; }
+
+    [[nodiscard]] std::span<Primitive *const> getGeometries() const { return _geometries; }
+
+    [[nodiscard]] std::span<const uint8_t> getFlags() const { return _flags; }
+
+    SceneStore &operator=(const SceneStore &) = delete;
+};
@@ -24,9 +24,9 @@ using Coordinates = std::pair<double, double>;
 class Intersection {
     static float calculateDistance(glm::vec3 origin, glm::vec3 direction, AABB box);
 
-    static PrimitivePtr findNearestPrimitive(const PrimitiveList &primitives, glm::vec3 origin, glm::vec3 direction);
+    static PrimitivePtr findNearestPrimitive(glm::vec3 origin, glm::vec3 direction);
 
 public:
-    static PrimitivePtr findNearestPrimitive(const PrimitiveList &primitives, const Window &window,
-                                             const Coordinates &mouse);
+    // Tests the world boxes of every active primitive in the scene store
+    static PrimitivePtr findNearestPrimitive(const Window &window, const Coordinates &mouse);
 };
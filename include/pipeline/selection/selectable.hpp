@@ -18,10 +18,7 @@ class Selectable {
     unsigned _VBO = 0;
     unsigned _EBO = 0;
 
-    [[nodiscard]] std::vector<glm::vec3> transformLocalBox() const;
-
 protected:
-    glm::mat4 _model = glm::mat4(1.0f);
     std::vector<PropertyPtr> _properties;
 
 public:
@@ -31,9 +28,9 @@ public:
 
     [[nodiscard]] std::vector<PropertyPtr> getProperties() const;
 
-    [[nodiscard]] AABB getCollisionBox() const;
-
     [[nodiscard]] virtual AABB getLocalBox() const = 0;
 
+    [[nodiscard]] virtual const glm::mat4 &getModel() const = 0;
+
     virtual ~Selectable();
 };
@@ -0,0 +1,45 @@
+#pragma once
+
+// STD Include //
+#include <vector>
+
+#include "application/logger.hpp"
+
+class Shader;
+
+// Programs are submitted without querying their status, then polled once per frame so the driver
+// compiles every pending program in flight together (in parallel with GL_KHR_parallel_shader_compile)
+class ShaderCompiler {
+    Logger _logger = Logger::getInstance();
+    std::vector<Shader *> _pending;
+    bool _initialized = false;
+    bool _parallel = false;
+    bool _reported = false;
+
+    explicit ShaderCompiler() = default;
+
+    void initialize();
+
+public:
+    static ShaderCompiler &getInstance() {
+        static ShaderCompiler instance;
+
+        return instance;
+    }
+
+    void submit(Shader &shader);
+
+    void cancel(const Shader &shader);
+
+    [[nodiscard]] bool isComplete(unsigned program);
+
+    void poll();
+
+    void finish();
+
+    [[nodiscard]] size_t getPendingCount() const { return _pending.size(); }
+
+    ShaderCompiler(const ShaderCompiler &) = delete;
+
+    void operator=(const ShaderCompiler &) = delete;
+};
@@ -1,9 +1,17 @@
 #pragma once
 
 #include "pipeline/shader.hpp"
+#include "pipeline/shader-variants.hpp"
+
+constexpr unsigned DEFAULT_SHADER_FEATURES = makeIlluminationFeature(4);
 
 class ShaderFactory {
-    Shader _texturedDepthShader = Shader("shaders/normalShader.vert", "shaders/normalShader.frag");
+    ShaderVariants _texturedDepthShaders = ShaderVariants("shaders/normalShader.vert", "shaders/normalShader.frag",
+                                                          SHADER_TEXTURED | SHADER_NORMAL_MAP |
+                                                          SHADER_ILLUMINATION_MASK);
+    ShaderVariants _gBufferShaders = ShaderVariants("shaders/normalShader.vert",
+                                                    "shaders/deferredGeometryShader.frag",
+                                                    SHADER_TEXTURED | SHADER_NORMAL_MAP);
     Shader _depthShader = Shader("shaders/depthShader.vert", "shaders/depthShader.frag");
     Shader _glowShader = Shader("shaders/basicShader.vert", "shaders/glowShader.frag");
 
@@ -16,12 +24,28 @@ public:
         return instance;
     }
 
-    [[nodiscard]] Shader &getTextureShader() { return _texturedDepthShader; }
+    [[nodiscard]] Shader &getTextureShader(const unsigned features = DEFAULT_SHADER_FEATURES) {
+        return _texturedDepthShaders.get(features);
+    }
+
+    [[nodiscard]] const ShaderVariants &getTextureShaders() const { return _texturedDepthShaders; }
+
+    void prepareTextureShader(const unsigned features) { _texturedDepthShaders.prepare(features); }
+
+    void prepareGBufferShader(const unsigned features) { _gBufferShaders.prepare(features); }
 
     [[nodiscard]] Shader &getDepthShader() { return _depthShader; }
 
     [[nodiscard]] Shader &getGlowShader() { return _glowShader; }
 
+    [[nodiscard]] Shader &getGBufferShader(const unsigned features = 0) { return _gBufferShaders.get(features); }
+
+    // Programs are swapped in place, references handed out to primitives stay valid
+    unsigned reloadShaders(const std::vector<std::string> &files) {
+        return _texturedDepthShaders.reloadIfChanged(files) + _gBufferShaders.reloadIfChanged(files) +
+               _depthShader.reloadIfChanged(files) + _glowShader.reloadIfChanged(files);
+    }
+
     void operator=(ShaderFactory const &) = delete;
 
     ShaderFactory(ShaderFactory &) = delete;
@@ -0,0 +1,43 @@
+#pragma once
+
+// STD Include //
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct PreprocessedSource {
+    std::string code;
+    // Indexed by the GLSL source string number emitted in the #line directives
+    std::vector<std::string> files;
+
+    [[nodiscard]] std::string mapLog(const std::string &log) const;
+};
+
+class ShaderPreprocessor {
+    static constexpr int MAX_INCLUDE_DEPTH = 16;
+
+    std::unordered_map<std::string, std::string> _files;
+
+    explicit ShaderPreprocessor() = default;
+
+    const std::string &readFile(const std::string &path);
+
+    void expand(const std::string &path, const std::vector<std::string> &defines, PreprocessedSource &source,
+                std::unordered_set<std::string> &included, int depth);
+
+public:
+    static ShaderPreprocessor &getInstance() {
+        static ShaderPreprocessor instance;
+
+        return instance;
+    }
+
+    [[nodiscard]] PreprocessedSource process(const std::string &path, const std::vector<std::string> &defines = {});
+
+    void invalidate(const std::string &path);
+
+    ShaderPreprocessor(const ShaderPreprocessor &) = delete;
+
+    void operator=(const ShaderPreprocessor &) = delete;
+};
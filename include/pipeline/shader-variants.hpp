@@ -0,0 +1,52 @@
+#pragma once
+
+// STD Include //
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "pipeline/shader.hpp"
+
+// Feature bitmask selecting a compile-time specialization of a shader
+constexpr unsigned SHADER_TEXTURED = 1u << 0;
+constexpr unsigned SHADER_NORMAL_MAP = 1u << 1;
+constexpr unsigned SHADER_ILLUMINATION_SHIFT = 2;
+constexpr unsigned SHADER_ILLUMINATION_MASK = 0x7u << SHADER_ILLUMINATION_SHIFT;
+
+[[nodiscard]] constexpr unsigned makeIlluminationFeature(const int illuminationModel) {
+    return (static_cast<unsigned>(illuminationModel) << SHADER_ILLUMINATION_SHIFT) & SHADER_ILLUMINATION_MASK;
+}
+
+[[nodiscard]] std::vector<std::string> getShaderDefines(unsigned features);
+
+class ShaderVariants {
+    std::string _vertexPath;
+    std::string _fragmentPath;
+    unsigned _featureMask;
+    std::unordered_map<unsigned, std::unique_ptr<Shader>> _variants;
+
+    Shader &submit(unsigned features);
+
+public:
+    explicit ShaderVariants(std::string vertexPath, std::string fragmentPath, unsigned featureMask);
+
+    ShaderVariants(const ShaderVariants &) = delete;
+
+    [[nodiscard]] Shader &get(unsigned features);
+
+    void prepare(unsigned features);
+
+    unsigned reloadIfChanged(const std::vector<std::string> &files);
+
+    // Pending variants are skipped, they only become ready in ShaderCompiler::poll at the start of a frame
+    template<typename Function>
+    void forEach(Function &&function) const {
+        for (const auto &[features, shader]: _variants) {
+            if (shader->isReady())
+                function(*shader);
+        }
+    }
+
+    ShaderVariants &operator=(const ShaderVariants &) = delete;
+};
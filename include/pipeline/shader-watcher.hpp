@@ -0,0 +1,41 @@
+#pragma once
+
+// STD Include //
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "application/logger.hpp"
+
+// Reports the shader sources modified on disk, through inotify on Linux and timestamp scans elsewhere
+class ShaderWatcher {
+    Logger _logger = Logger::getInstance();
+    std::filesystem::path _directory;
+
+#ifdef __linux__
+    int _descriptor = -1;
+    std::unordered_map<int, std::filesystem::path> _watches;
+#else
+    static constexpr std::chrono::milliseconds SCAN_INTERVAL{500};
+
+    std::unordered_map<std::string, std::filesystem::file_time_type> _timestamps;
+    std::chrono::steady_clock::time_point _lastScan;
+#endif
+
+public:
+    explicit ShaderWatcher(std::filesystem::path directory = "shaders");
+
+    ShaderWatcher(const ShaderWatcher &) = delete;
+
+    // Paths are normalized the same way as the preprocessor, which has already dropped them from its cache
+    [[nodiscard]] std::vector<std::string> poll();
+
+    ShaderWatcher &operator=(const ShaderWatcher &) = delete;
+
+    ~ShaderWatcher();
+};
+
+using ShaderWatcherPtr = std::unique_ptr<ShaderWatcher>;
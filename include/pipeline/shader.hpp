@@ -4,27 +4,81 @@
 #include <glm/glm.hpp>
 
 // STD Include //
+#include <chrono>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "application/logger.hpp"
+#include "pipeline/shader-preprocessor.hpp"
+
+constexpr unsigned LIGHTS_BLOCK_BINDING = 0;
+
+// Compile state of a submitted program, released once the driver has finished linking it
+struct PendingProgram {
+    unsigned program;
+    unsigned vertexShader;
+    unsigned fragmentShader;
+    std::string cacheKey;
+    PreprocessedSource vertexSource;
+    PreprocessedSource fragmentSource;
+    std::chrono::steady_clock::time_point start;
+};
 
 class Shader {
     unsigned int _id;
     Logger _logger = Logger::getInstance();
+    std::string _vertexPath;
+    std::string _fragmentPath;
+    std::vector<std::string> _defines;
+    std::vector<std::string> _files;
+    // Key of the current program, its binary is dropped from the cache once a reload replaces it
+    std::string _cacheKey;
+    std::vector<std::pair<std::string, unsigned>> _uniformBlocks;
+    mutable std::unique_ptr<PendingProgram> _pending;
+    std::unique_ptr<PendingProgram> _reload;
+
+    [[nodiscard]] static std::unique_ptr<PendingProgram> submit(unsigned program, PreprocessedSource vertexSource,
+                                                                PreprocessedSource fragmentSource,
+                                                                std::string cacheKey,
+                                                                std::chrono::steady_clock::time_point start);
+
+    void trackFiles(const PreprocessedSource &vertexSource, const PreprocessedSource &fragmentSource);
+
+    bool checkCompileErrors(unsigned int shader, const std::string &type,
+                            const PreprocessedSource *source = nullptr) const;
+
+    bool link(const PendingProgram &pending) const;
+
+    void applyUniformBlocks(unsigned program) const;
 
-    void checkCompileErrors(unsigned int shader, const std::string &type) const;
+    void finalize() const;
 
-    static std::string readShaderFile(const std::string &filePath);
+    void swapReload();
 
 public:
-    Shader(const char *vertexPath, const char *fragmentPath);
+    Shader(const char *vertexPath, const char *fragmentPath, const std::vector<std::string> &defines = {});
 
     Shader(const Shader &) = delete;
 
+    [[nodiscard]] bool isReady() const { return !_pending; }
+
+    bool poll();
+
+    void wait() const;
+
+    [[nodiscard]] bool dependsOn(const std::vector<std::string> &files) const;
+
+    // Recompiles in the background when one of the files is part of this program, the swap happens in poll
+    bool reloadIfChanged(const std::vector<std::string> &files);
+
     void use() const;
 
     unsigned int getId() const;
 
+    void bindUniformBlock(const std::string &name, unsigned binding);
+
     void setBool(const std::string &name, bool value) const;
 
     void setInt(const std::string &name, int value) const;
@@ -51,5 +105,5 @@ public:
 
     Shader &operator=(const Shader &) = delete;
 
-    ~Shader() = default;
+    ~Shader();
 };
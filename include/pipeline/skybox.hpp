@@ -13,6 +13,8 @@ public:
 
     static unsigned int loadCubeMap(const std::array<std::string, 6> &faces);
 
+    unsigned reloadShaders(const std::vector<std::string> &files) { return _shader.reloadIfChanged(files); }
+
 private:
     unsigned int _vao = 0;
     unsigned int _vbo = 0;
@@ -53,8 +53,11 @@ class Window {
 public:
     static constexpr int WIDTH = 1920;
     static constexpr int HEIGHT = 1080;
+    static constexpr float Z_NEAR = 0.1f;
+    static constexpr float Z_FAR = 100.0f;
 
-    Window(int width, int height);
+    // Headless windows are never shown, without a display server the context comes from OSMesa when available
+    Window(int width, int height, bool headless = false);
 
     Window(const Window &) = delete;
 
@@ -104,6 +107,8 @@ public:
 
     void setCameraPosition(glm::vec3 newPosition);
 
+    void setCameraOrientation(float yaw, float pitch);
+
     void setDeltaTime(float newDeltaTime);
 
     void setLastFrame(float newLastFrame);
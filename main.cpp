@@ -1,9 +1,15 @@
 // Header File Include //
 #include "application/application.hpp"
 
-int main() {
-    Application application;
+int main(const int argc, char **argv) {
+    const RunOptions options = RunOptions::parse(argc, argv);
+    Application application(options);
 
-    application.run();
+    if (options.benchmark)
+        application.runBenchmark();
+    else if (options.headless)
+        application.runHeadless();
+    else
+        application.run();
     return 0;
 }
@@ -0,0 +1,21 @@
+#version 410
+
+layout (location = 0) out vec4 FragColor;
+layout (location = 1) out vec4 FilterMask;
+
+in vec2 TexCoord;
+
+uniform sampler2D accumulation;
+uniform sampler2D gMaterial;
+uniform sampler2D gDepth;
+
+void main() {
+    float depth = texture(gDepth, TexCoord).r;
+    if (depth >= 1.0)
+        discard;
+
+    // The filter itself is applied by the post pass, only the mask is carried over
+    FragColor = vec4(texture(accumulation, TexCoord).rgb, 1.0);
+    FilterMask = vec4(texture(gMaterial, TexCoord).r, 0.0, 0.0, 1.0);
+    gl_FragDepth = depth;
+}
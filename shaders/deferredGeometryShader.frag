@@ -0,0 +1,36 @@
+#version 410
+
+layout (location = 0) out vec4 AlbedoMetallic;
+layout (location = 1) out vec4 NormalRoughness;
+layout (location = 2) out vec4 Material;
+
+in vec2 TexCoord;
+in mat3 TBN;
+
+uniform sampler2D texture_diffuse1;
+uniform sampler2D texture_normal1;
+
+uniform vec3 color;
+uniform float roughness;
+uniform float metallic;
+uniform int filterType;
+
+void main() {
+#ifdef NORMAL_MAP
+    vec3 normal = texture(texture_normal1, TexCoord).rgb;
+    normal = normalize(normal * 2.0 - 1.0);
+    normal = normalize(TBN * normal);
+#else
+    vec3 normal = TBN[2];
+#endif
+
+#ifdef TEXTURED
+    vec3 albedo = texture(texture_diffuse1, TexCoord).rgb;
+#else
+    vec3 albedo = color;
+#endif
+
+    AlbedoMetallic = vec4(albedo, metallic);
+    NormalRoughness = vec4(normalize(normal), roughness);
+    Material = vec4(float(filterType) / 255.0, 0.0, 0.0, 1.0);
+}
@@ -0,0 +1,88 @@
+#version 410
+
+#include "lib/lights.glsl"
+#include "lib/brdf.glsl"
+#include "lib/shadow.glsl"
+
+out vec4 FragColor;
+
+in vec2 TexCoord;
+
+uniform sampler2D gAlbedoMetallic;
+uniform sampler2D gNormalRoughness;
+uniform sampler2D gDepth;
+
+uniform mat4 inverseViewProjection;
+uniform vec3 cameraPosition;
+
+uniform samplerCube skybox;
+uniform float reflectionStrength;
+
+uniform sampler2D shadowMap;
+
+void main() {
+    float depth = texture(gDepth, TexCoord).r;
+    if (depth >= 1.0)
+        discard;
+
+    vec4 albedoMetallic = texture(gAlbedoMetallic, TexCoord);
+    vec4 normalRoughness = texture(gNormalRoughness, TexCoord);
+    vec4 position = inverseViewProjection * vec4(vec3(TexCoord, depth) * 2.0 - 1.0, 1.0);
+    vec3 fragPos = position.xyz / position.w;
+    vec3 albedo = albedoMetallic.rgb;
+    float metallic = albedoMetallic.a;
+    vec3 normal = normalize(normalRoughness.xyz);
+    float roughness = normalRoughness.a;
+
+    vec3 lightDirection = normalize(-lightDir);
+    vec3 viewDirection = normalize(cameraPosition - fragPos);
+
+    vec3 F0 = vec3(0.04);
+    F0 = mix(F0, albedo, metallic);
+    float NdotV = max(dot(normal, viewDirection), 0.0);
+    vec3 fresnel = F0 + (1.0 - F0) * pow(1.0 - NdotV, 5.0);
+    vec3 kD = (1.0 - fresnel) * (1.0 - metallic);
+
+    // Spotlight calculations
+    vec3 spotToFrag = normalize(fragPos - spotPos);
+    float theta = dot(spotToFrag, normalize(-spotDir));
+    float epsilon = cutOff - outerCutOff;
+    float spotIntensity = clamp((theta - outerCutOff) / epsilon, 0.0, 1.0);
+    float NdotL_spot = max(dot(normal, -spotToFrag), 0.0);
+    vec3 spotHalfway = normalize(-spotToFrag + viewDirection);
+    float spotSpecStrength = pow(max(dot(normal, spotHalfway), 0.0), (1.0 - roughness) * 128.0);
+    vec3 spotDiffuse = kD * albedo / PI * NdotL_spot;
+    vec3 spotSpecular = spotSpecStrength * fresnel * lightColor;
+    vec3 spotlight = (spotDiffuse + spotSpecular) * spotIntensity;
+
+    // Base lighting model, Gouraud has no per-vertex data here and falls back to Lambert
+    vec3 baseLighting = vec3(0.0);
+#if ILLUMINATION_MODEL == 0 || ILLUMINATION_MODEL == 1
+    float NdotL = max(dot(normal, lightDirection), 0.0);
+    baseLighting = albedo * lightColor * NdotL;
+#elif ILLUMINATION_MODEL == 4
+    vec3 H = normalize(viewDirection + lightDirection);
+    float NDF = DistributionGGX(normal, H, roughness);
+    float G = GeometrySmith(normal, viewDirection, lightDirection, roughness);
+    vec3 numerator = NDF * G * fresnel;
+    float denominator = 4.0 * NdotV * max(dot(normal, lightDirection), 0.0) + 0.001;
+    vec3 specular = numerator / denominator;
+    vec3 diffuse = kD * albedo / PI;
+    baseLighting = (diffuse + specular) * lightColor * max(dot(normal, lightDirection), 0.0);
+#endif
+
+    float shadow = calculateShadow(shadowMap, lightSpaceMatrix * vec4(fragPos, 1.0), normal, lightDirection);
+    vec3 ambient = albedo * ambientColor;
+    vec3 finalColor = ambient + baseLighting * (1.0 - shadow) + spotlight;
+
+    // Reflection mapping, point light volumes are scaled by the same factor
+    vec3 I = normalize(fragPos - cameraPosition);
+    vec3 R = reflect(I, normal);
+    vec3 reflectionColor = texture(skybox, R).rgb;
+    vec3 reflectionMapped = reflectionColor / (reflectionColor + vec3(1.0));
+    reflectionMapped *= (1.0 - roughness);
+    float reflectionFactor = clamp(fresnel.r * reflectionStrength, 0.0, 1.0);
+    finalColor = mix(finalColor, reflectionMapped, reflectionFactor);
+
+    FragColor = vec4(finalColor, 1.0);
+}
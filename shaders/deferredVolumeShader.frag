@@ -0,0 +1,52 @@
+#version 410
+
+#include "lib/lights.glsl"
+#include "lib/brdf.glsl"
+
+out vec4 FragColor;
+
+flat in int LightIndex;
+
+uniform sampler2D gAlbedoMetallic;
+uniform sampler2D gNormalRoughness;
+uniform sampler2D gDepth;
+uniform samplerBuffer pointLightData;
+
+uniform mat4 inverseViewProjection;
+uniform vec3 cameraPosition;
+uniform vec2 screenSize;
+uniform float reflectionStrength;
+
+void main() {
+    vec2 texCoord = gl_FragCoord.xy / screenSize;
+    float depth = texture(gDepth, texCoord).r;
+    if (depth >= 1.0)
+        discard;
+
+    vec4 positionRadius = texelFetch(pointLightData, LightIndex * 2);
+    vec3 pointColor = texelFetch(pointLightData, LightIndex * 2 + 1).rgb;
+    vec4 position = inverseViewProjection * vec4(vec3(texCoord, depth) * 2.0 - 1.0, 1.0);
+    vec3 fragPos = position.xyz / position.w;
+    float distance = length(positionRadius.xyz - fragPos);
+    if (distance >= positionRadius.w)
+        discard;
+
+    vec4 albedoMetallic = texture(gAlbedoMetallic, texCoord);
+    vec4 normalRoughness = texture(gNormalRoughness, texCoord);
+    vec3 albedo = albedoMetallic.rgb;
+    float metallic = albedoMetallic.a;
+    vec3 N = normalize(normalRoughness.xyz);
+    float roughness = normalRoughness.a;
+
+    vec3 V = normalize(cameraPosition - fragPos);
+    vec3 L = normalize(positionRadius.xyz - fragPos);
+    vec3 F0 = mix(vec3(0.04), albedo, metallic);
+    vec3 radiance = CookTorrance(N, V, L, albedo, F0, roughness, metallic) * pointColor
+                    * getPointLightAttenuation(distance, positionRadius.w);
+
+    // Match the forward shader where point lights are mixed with the reflection
+    vec3 fresnel = F0 + (1.0 - F0) * pow(1.0 - max(dot(N, V), 0.0), 5.0);
+    float reflectionFactor = clamp(fresnel.r * reflectionStrength, 0.0, 1.0);
+
+    FragColor = vec4(radiance * (1.0 - reflectionFactor), 1.0);
+}
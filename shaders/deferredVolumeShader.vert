@@ -0,0 +1,18 @@
+#version 410
+
+layout (location = 0) in vec3 aPos;
+
+flat out int LightIndex;
+
+uniform samplerBuffer pointLightData;
+uniform mat4 viewProjection;
+
+// Low-poly spheres are inscribed in the light radius, grow them to stay conservative
+#define VOLUME_SCALE 1.1
+
+void main() {
+    vec4 positionRadius = texelFetch(pointLightData, gl_InstanceID * 2);
+
+    LightIndex = gl_InstanceID;
+    gl_Position = viewProjection * vec4(positionRadius.xyz + aPos * positionRadius.w * VOLUME_SCALE, 1.0);
+}
@@ -5,6 +5,8 @@ layout (location = 0) in vec3 aPos;
 uniform mat4 model;
 uniform mat4 lightSpaceMatrix;
 
+invariant gl_Position;
+
 void main() {
-    gl_Position = lightSpaceMatrix * model * vec4(aPos, 1.0);
+    gl_Position = lightSpaceMatrix * (model * vec4(aPos, 1.0));
 }
@@ -0,0 +1,25 @@
+#version 410
+
+out vec4 FragColor;
+
+uniform sampler2D logLuminance;
+uniform sampler2D previousExposure;
+
+uniform float averageLevel;
+uniform float deltaTime;
+uniform float adaptationSpeed;
+
+// Middle grey the average luminance is mapped to
+const float KEY_VALUE = 0.18;
+const float MIN_EXPOSURE = 0.05;
+const float MAX_EXPOSURE = 20.0;
+
+void main() {
+    float averageLuminance = exp2(textureLod(logLuminance, vec2(0.5), averageLevel).r);
+    float target = clamp(KEY_VALUE / averageLuminance, MIN_EXPOSURE, MAX_EXPOSURE);
+    float previous = texelFetch(previousExposure, ivec2(0), 0).r;
+
+    // Frame rate independent, adapting in log space feels the same going darker or brighter
+    float blend = 1.0 - exp(-deltaTime * adaptationSpeed);
+    FragColor = vec4(exp2(mix(log2(previous), log2(target), blend)), 0.0, 0.0, 1.0);
+}
@@ -0,0 +1,21 @@
+// Must match light-repository.hpp and light-buffer.hpp
+#define POINT_LIGHT_CONSTANT 1.0
+#define POINT_LIGHT_LINEAR 0.09
+#define POINT_LIGHT_QUADRATIC 0.032
+
+layout (std140) uniform Lights {
+    mat4 lightSpaceMatrix;
+    vec3 lightDir;
+    float cutOff;
+    vec3 lightColor;
+    float outerCutOff;
+    vec3 ambientColor;
+    vec3 spotPos;
+    vec3 spotDir;
+};
+
+float getPointLightAttenuation(float distance, float radius) {
+    float window = clamp(1.0 - pow(distance / radius, 4.0), 0.0, 1.0);
+
+    return window * window / (POINT_LIGHT_CONSTANT + POINT_LIGHT_LINEAR * distance + POINT_LIGHT_QUADRATIC * (distance * distance));
+}
@@ -0,0 +1,17 @@
+vec3 applyFilter(vec3 color, int filterType) {
+    if (filterType == 1) { // Grayscale
+        float gray = dot(color, vec3(0.299, 0.587, 0.114));
+        return vec3(gray);
+    } else if (filterType == 2) { // Inverted
+        return vec3(1.0) - color;
+    } else if (filterType == 3) { // Posterize
+        float levels = 8.0;
+        return floor(color * levels) / levels;
+    }
+    return color;
+}
+
+vec3 toneMap(vec3 color, float exposure) {
+    vec3 hdrColor = color * exposure;
+    return hdrColor / (hdrColor + vec3(1.0));
+}
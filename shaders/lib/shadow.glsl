@@ -0,0 +1,21 @@
+// 5x5 PCF over the directional light shadow map
+float calculateShadow(sampler2D shadowMap, vec4 fragPosLightSpace, vec3 normal, vec3 direction) {
+    vec3 projCoords = fragPosLightSpace.xyz / fragPosLightSpace.w;
+    projCoords = projCoords * 0.5 + 0.5;
+
+    if (projCoords.z > 1.0)
+        return 0.0;
+
+    float shadow = 0.0;
+    float bias = max(0.05 * (1.0 - dot(normal, direction)), 0.005);
+    float currentDepth = projCoords.z;
+    vec2 texelSize = 1.0 / textureSize(shadowMap, 0);
+
+    for (int x = -2; x <= 2; x++) {
+        for (int y = -2; y <= 2; y++) {
+            float pcfDepth = texture(shadowMap, projCoords.xy + vec2(x, y) * texelSize).r;
+            shadow += currentDepth - bias > pcfDepth ? 1.0 : 0.0;
+        }
+    }
+    return shadow / 25.0;
+}
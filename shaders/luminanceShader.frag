@@ -0,0 +1,14 @@
+#version 410
+
+out vec4 FragColor;
+
+in vec2 TexCoord;
+
+uniform sampler2D hdrColor;
+
+void main() {
+    float luminance = dot(texture(hdrColor, TexCoord).rgb, vec3(0.2126, 0.7152, 0.0722));
+
+    // Log space keeps a few very bright pixels from dominating the average
+    FragColor = vec4(log2(max(luminance, 0.0001)), 0.0, 0.0, 1.0);
+}
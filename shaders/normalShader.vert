@@ -9,22 +9,20 @@ out vec2 TexCoord;
 out vec3 FragPos;
 out mat3 TBN;
 out vec3 GouraudLight;
-out vec3 GouraudAlbedo;
 out vec4 FragPosLightSpace;
+out float ViewDepth;
+
+// Must produce the exact same depth as depthShader.vert for the GL_EQUAL pre-pass test
+invariant gl_Position;
 
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
+uniform mat4 viewProjection;
 
-uniform vec3 color;
-uniform vec3 ambientColor;
-uniform vec3 lightDir;
-uniform vec3 lightColor;
 uniform vec3 cameraPosition;
 
-uniform int illuminationModel;
-
-uniform mat4 lightSpaceMatrix;
+#include "lib/lights.glsl"
 
 void main() {
     vec3 T = normalize(mat3(model) * aTangent);
@@ -35,29 +33,26 @@ void main() {
     FragPos = vec3(model * vec4(aPos, 1.0));
     TexCoord = aTexCoord;
 
-    gl_Position = projection * view * model * vec4(aPos, 1.0f);
+    gl_Position = viewProjection * (model * vec4(aPos, 1.0));
 
     GouraudLight = vec3(0.0);
-    GouraudAlbedo = vec3(1.0);
-
-    if (illuminationModel == 1) {
-        vec3 albedo = (color.r != -1.0 && color.g != -1.0 && color.b != -1.0) ? color : vec3(1.0);
-        GouraudAlbedo = albedo;
 
-        vec3 normal = normalize(mat3(model) * aNormal);
-        vec3 lightDirection = normalize(-lightDir);
-        vec3 viewDir = normalize(cameraPosition - FragPos);
-        vec3 halfwayDir = normalize(lightDirection + viewDir);
+#if ILLUMINATION_MODEL == 1
+    vec3 normal = normalize(mat3(model) * aNormal);
+    vec3 lightDirection = normalize(-lightDir);
+    vec3 viewDir = normalize(cameraPosition - FragPos);
+    vec3 halfwayDir = normalize(lightDirection + viewDir);
 
-        float NdotL = max(dot(normal, lightDirection), 0.0);
-        float spec = pow(max(dot(normal, halfwayDir), 0.0), 32.0);
+    float NdotL = max(dot(normal, lightDirection), 0.0);
+    float spec = pow(max(dot(normal, halfwayDir), 0.0), 32.0);
 
-        vec3 ambient = ambientColor;
-        vec3 diffuse = NdotL * lightColor;
-        vec3 specular = spec * lightColor;
+    vec3 ambient = ambientColor;
+    vec3 diffuse = NdotL * lightColor;
+    vec3 specular = spec * lightColor;
 
-        GouraudLight = ambient + diffuse + specular;
-    }
+    GouraudLight = ambient + diffuse + specular;
+#endif
 
     FragPosLightSpace = lightSpaceMatrix * vec4(FragPos, 1.0);
+    ViewDepth = -(view * vec4(FragPos, 1.0)).z;
 }
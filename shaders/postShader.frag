@@ -0,0 +1,36 @@
+#version 410
+
+#include "lib/post.glsl"
+
+out vec4 FragColor;
+
+in vec2 TexCoord;
+
+uniform sampler2D hdrColor;
+uniform sampler2D hdrDepth;
+uniform sampler2D filterMask;
+uniform sampler2D adaptedExposure;
+
+uniform bool  enableToneMapping;
+uniform bool  autoExposure;
+uniform float toneMappingExposure;
+
+void main() {
+    vec3 color = texture(hdrColor, TexCoord).rgb;
+    int filterType = int(texelFetch(filterMask, ivec2(gl_FragCoord.xy), 0).r * 255.0 + 0.5);
+
+    // Once per pixel whatever the overdraw, only the pixels of filtered objects carry a non zero mask
+    color = applyFilter(color, filterType);
+    if (enableToneMapping) {
+        float exposure = toneMappingExposure;
+
+        // The manual exposure becomes a compensation on top of the adapted one
+        if (autoExposure)
+            exposure *= texelFetch(adaptedExposure, ivec2(0), 0).r;
+        color = toneMap(color, exposure);
+    }
+
+    FragColor = vec4(color, 1.0);
+    // Selection outlines and menus drawn after the resolve still depth test against the scene
+    gl_FragDepth = texture(hdrDepth, TexCoord).r;
+}
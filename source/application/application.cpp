@@ -1,10 +1,11 @@
 // Header File Include //
 #include "application/application.hpp"
+#include "application/benchmark-scene.hpp"
+#include "application/light-repository.hpp"
+#include "pipeline/gl-stats.hpp"
+#include "pipeline/shader-compiler.hpp"
 #include "pipeline/texture-loader.hpp"
 
-#define STB_IMAGE_WRITE_IMPLEMENTATION
-#include "stb_image_write.h"
-
 // GLM Include //
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -17,7 +18,9 @@
 
 // STD Include //
 #include <filesystem>
+#include <fstream>
 #include <chrono>
+#include <cstdint>
 #include <vector>
 
 void Application::initializeDefaultScene() {
@@ -146,12 +149,15 @@ void Application::initializeDefaultScene() {
     _primitives.push_back(catmullRomCurve);
 }
 
-Application::Application() {
+Application::Application(const RunOptions &options)
+    : _options(options), _window(Window::WIDTH, Window::HEIGHT, options.headless),
+      _imageWriter(std::make_unique<ImageWriter>()),
+      _readback(std::make_unique<AsyncReadback>(2, [this](ImageJob job) { _imageWriter->submit(std::move(job)); })) {
     _primitiveMenu = std::make_unique<PrimitiveMenu>([this](const PrimitivePtr &primitive) {
         _primitives.emplace_back(primitive);
     });
 
-    _topLeftMenu = std::make_unique<Histogram>(_window);
+    _topLeftMenu = std::make_unique<Histogram>(_window, _pipeline.getFrameHistogram());
     _modelMenu = std::make_unique<ModelMenu>(*this);
     _graphMenu = std::make_unique<GraphMenu>(_window, _primitives);
     _configurationMenu = std::make_unique<ConfigurationMenu>(_window, [this](const PrimitivePtr &primitive) {
@@ -161,9 +167,16 @@ Application::Application() {
     _illuminationMenu = std::make_unique<IlluminationTypeMenu>();
     _sceneMenu = std::make_unique<SceneMenu>();
     _lightMenu = std::make_unique<LightMenu>();
+    _profilerMenu = std::make_unique<ProfilerMenu>();
+#ifdef GL_STATS_ENABLED
+    _glStatsMenu = std::make_unique<GlStatsMenu>();
+#endif
 
     initializeDefaultScene();
+    _pipeline.prepareShaders(_primitives);
     initializeImgui();
+    if (!options.eventLogPath.empty())
+        EventLog::getInstance().open(options.eventLogPath);
 }
 
 void Application::initializeImgui() const {
@@ -196,25 +209,235 @@ void Application::initializeImgui() const {
 void Application::run() {
     GLFWwindow *window = _window.getWindowInstance();
 
+    Profiler &profiler = Profiler::getInstance();
+    const double recordStart = glfwGetTime();
+    uint64_t recordedFrames = 0;
+
+    profiler.setThreadName("Main");
+    if (!_options.recordTarget.empty()) {
+        int width;
+        int height;
+
+        glfwGetFramebufferSize(window, &width, &height);
+        startRecording(width, height);
+    }
     while (!glfwWindowShouldClose(window)) {
+        const auto start = std::chrono::steady_clock::now();
+
+        profiler.beginFrame();
+        EventLog::getInstance().beginFrame();
+        GpuProfiler::getInstance().beginFrame();
+#ifdef GL_STATS_ENABLED
+        GlStats::getInstance().beginFrame();
+#endif
+        PROFILE_ZONE("Frame");
+        // Each recorded frame advances the scene by one video frame whatever the loop rate, so playback speed is right
+        if (_videoReadback != nullptr)
+            glfwSetTime(recordStart + static_cast<double>(recordedFrames++) / FRAME_RATE);
         const auto currentFrame = static_cast<float>(glfwGetTime());
 
         _window.setDeltaTime(currentFrame - _window.getLastFrame());
         _window.setLastFrame(currentFrame);
 
-        glfwPollEvents();
-        _window.processInput();
-        handleMouseButton();
-        handleKey();
+        {
+            PROFILE_ZONE("Input");
+            glfwPollEvents();
+            _window.processInput();
+            handleMouseButton();
+            handleKey();
+        }
 
         glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         render();
-        glfwSwapBuffers(window);
+
+        _readback->poll();
+        if (_videoReadback != nullptr)
+            _videoReadback->poll();
+        {
+            PROFILE_ZONE("Swap");
+            glfwSwapBuffers(window);
+        }
+        recordFrameEvents(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
     }
+    _readback->finish();
+    stopRecording();
     glfwTerminate();
 }
 
+void Application::runHeadless() {
+    const OffscreenTarget target(Window::WIDTH, Window::HEIGHT);
+    const CameraPath cameraPath(_options.cameraPath);
+
+    _logger.info("Headless run: {} frames after {} warm-up frames", _options.frames, _options.warmupFrames);
+    if (_options.captureInterval > 0)
+        std::filesystem::create_directories(_options.captureDirectory);
+    // Every variant is ready before the first frame, compilation never lands in the measurements
+    ShaderCompiler::getInstance().finish();
+    if (!_options.recordTarget.empty())
+        startRecording(target.getWidth(), target.getHeight());
+    renderOffscreen(target, cameraPath, _options.captureInterval > 0).write(_options.statsPath);
+    stopRecording();
+}
+
+void Application::runBenchmark() {
+    const OffscreenTarget target(Window::WIDTH, Window::HEIGHT);
+    const CameraPath cameraPath(_options.cameraPath);
+    LightRepository &lightRepository = LightRepository::getInstance();
+    const std::vector<Light> pointLights = lightRepository.getPointLights();
+    const std::vector<BenchmarkScene> scenes = BenchmarkScene::getDefaultScenes();
+    PrimitiveList defaultScene = std::move(_primitives);
+    std::ofstream file(_options.statsPath, std::ios::trunc);
+
+    if (!file.is_open()) {
+        _logger.error("Cannot write benchmark results to {}", _options.statsPath);
+        return;
+    }
+    _selectedPrimitive = nullptr;
+    // The scene store renders every active primitive, the default scene sits out the benchmarks
+    for (const PrimitivePtr &primitive: defaultScene)
+        primitive->setActive(false);
+    file << "{\n  \"benchmarks\": [";
+    for (size_t index = 0; index < scenes.size(); index++) {
+        const BenchmarkScene &scene = scenes[index];
+
+        _logger.info("Benchmark {}: {} frames after {} warm-up frames", scene.name, _options.frames,
+                     _options.warmupFrames);
+        _primitives = scene.build();
+        _pipeline.prepareShaders(_primitives);
+        ShaderCompiler::getInstance().finish();
+        GpuProfiler::getInstance().resetHistory();
+
+        const FrameStats stats = renderOffscreen(target, cameraPath, false);
+
+        file << std::format("{}\n    {{{}, \"results\": {}}}", index == 0 ? "" : ",", scene.describe(),
+                            stats.toJson("    "));
+    }
+    file << "\n  ]\n}\n";
+    _logger.info("Benchmark results written to {}", _options.statsPath);
+
+    _primitives = std::move(defaultScene);
+    for (const PrimitivePtr &primitive: _primitives)
+        primitive->setActive(true);
+    while (!lightRepository.getPointLights().empty())
+        lightRepository.removePointLight(lightRepository.getPointLights().size() - 1);
+    for (const Light &light: pointLights)
+        lightRepository.addPointLight(light);
+}
+
+FrameStats Application::renderOffscreen(const OffscreenTarget &target, const CameraPath &cameraPath,
+                                        const bool capture) {
+    constexpr double frameRate = FRAME_RATE;
+    const int frameCount = _options.warmupFrames + _options.frames;
+    Profiler &profiler = Profiler::getInstance();
+    FrameStats stats;
+
+    _pipeline.setTargetFramebuffer(target.getFramebuffer(), target.getWidth(), target.getHeight());
+    profiler.setThreadName("Main");
+
+    for (int frame = 0; frame < frameCount; frame++) {
+        const auto start = std::chrono::steady_clock::now();
+        const int measuredFrame = frame - _options.warmupFrames;
+
+        profiler.beginFrame();
+        EventLog::getInstance().beginFrame();
+        GpuProfiler::getInstance().beginFrame();
+#ifdef GL_STATS_ENABLED
+        GlStats::getInstance().beginFrame();
+#endif
+        {
+            PROFILE_ZONE("Frame");
+            glfwSetTime(frame / frameRate);
+            _window.setDeltaTime(static_cast<float>(1.0 / frameRate));
+            _window.setLastFrame(static_cast<float>(frame / frameRate));
+            if (!cameraPath.empty()) {
+                const CameraKey key = cameraPath.sample(static_cast<float>(frame) / std::max(frameCount - 1, 1));
+
+                _window.setCameraPosition(key.position - _window.getCameraPosition());
+                _window.setCameraOrientation(key.yaw, key.pitch);
+            }
+            glfwPollEvents();
+
+            glBindFramebuffer(GL_FRAMEBUFFER, target.getFramebuffer());
+            glViewport(0, 0, target.getWidth(), target.getHeight());
+            glClearColor(0.2f, 0.2f, 0.2f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            {
+                PROFILE_ZONE("Pipeline");
+                PROFILE_GPU_ZONE("Pipeline");
+                _pipeline.render(_window.getView(), _window.getProjection());
+            }
+            PROFILE_ZONE("Finish");
+            glFinish();
+        }
+        _readback->poll();
+        if (_videoReadback != nullptr)
+            _videoReadback->poll();
+        const double milliseconds = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+
+        recordFrameEvents(milliseconds);
+        if (measuredFrame < 0)
+            continue;
+        stats.record(milliseconds);
+        if (capture && measuredFrame % _options.captureInterval == 0) {
+            const std::string filename = std::format("{}/frame_{:05}.png", _options.captureDirectory, measuredFrame);
+
+            _readback->request(target.getFramebuffer(), target.getWidth(), target.getHeight(), filename);
+        }
+        if (_videoReadback != nullptr)
+            _videoReadback->request(target.getFramebuffer(), _videoWriter->getWidth(), _videoWriter->getHeight(), "");
+    }
+    _readback->finish();
+    if (_videoReadback != nullptr)
+        _videoReadback->finish();
+
+    _pipeline.setTargetFramebuffer(0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    return stats;
+}
+
+void Application::startRecording(const int width, const int height) {
+    _videoWriter = std::make_unique<VideoWriter>(_options.recordTarget, width, height, FRAME_RATE);
+    if (!_videoWriter->isOpen()) {
+        _videoWriter = nullptr;
+        return;
+    }
+    // Three frames in flight give the GPU room to finish a copy before its buffer comes around again
+    _videoReadback = std::make_unique<AsyncReadback>(3, [this](ImageJob job) {
+        _videoWriter->submit(std::move(job));
+    });
+}
+
+void Application::recordFrameEvents(const double milliseconds) const {
+    EventLog &events = EventLog::getInstance();
+
+    if (!events.isOpen())
+        return;
+    events.record(FRAME_EVENT, {milliseconds});
+#ifdef GL_STATS_ENABLED
+    const GlPassCounters &passes = GlStats::getInstance().getCurrentFrame();
+
+    for (int pass = 0; pass < GL_PASS_COUNT; pass++) {
+        const GlCounters &counters = passes[pass];
+
+        if (counters.glCalls == 0)
+            continue;
+        events.record(DRAW_EVENT, {static_cast<double>(counters.drawCalls), static_cast<double>(counters.triangles),
+                                   static_cast<double>(counters.vertices), static_cast<double>(counters.glCalls),
+                                   static_cast<double>(counters.bufferBytes)}, glPassNames[pass]);
+    }
+#endif
+}
+
+void Application::stopRecording() {
+    if (_videoReadback == nullptr)
+        return;
+    _videoReadback->finish();
+    _videoReadback = nullptr;
+    _videoWriter = nullptr;
+}
+
 void Application::render() {
     const glm::mat4 view = _window.getView();
     const glm::mat4 projection = _window.getProjection();
@@ -225,26 +448,57 @@ void Application::render() {
         ImGui::NewFrame();
     }
 
-    _pipeline.render(_primitives, view, projection);
-    if (_selectedPrimitive != nullptr)
+    {
+        PROFILE_ZONE("Pipeline");
+        PROFILE_GPU_ZONE("Pipeline");
+        _pipeline.render(view, projection);
+    }
+    if (_selectedPrimitive != nullptr) {
+        PROFILE_ZONE("Selection box");
+        PROFILE_GPU_ZONE("Selection box");
+        GL_STATS_PASS(SELECTION_PASS);
         _selectedPrimitive->renderSelectionBox(view, projection);
+    }
+    // Recorded before the menus are drawn, the video never shows ImGui
+    if (_videoReadback != nullptr) {
+        int width;
+        int height;
+
+        glfwGetFramebufferSize(_window.getWindowInstance(), &width, &height);
+        if (width < _videoWriter->getWidth() || height < _videoWriter->getHeight()) {
+            _logger.warn("Window shrank below the recorded size, recording stopped");
+            stopRecording();
+        } else {
+            _videoReadback->request(0, _videoWriter->getWidth(), _videoWriter->getHeight(), "");
+        }
+    }
     if (_primitiveMenuPosition.x != -1.0f && _primitiveMenuPosition.y != -1.0f)
         _primitiveMenu->render(_primitiveMenuPosition.x, _primitiveMenuPosition.y);
     if (_modelMenuPosition.x != -1.0f && _modelMenuPosition.y != -1.0f)
         _modelMenu->render(_modelMenuPosition.x, _modelMenuPosition.y);
     if (_showImgui) {
+        PROFILE_ZONE("ImGui");
+        PROFILE_GPU_ZONE("ImGui");
         _lightMenu->render();
         _illuminationMenu->render();
         _configurationMenu->updateSelectedPrimitive(_selectedPrimitive);
         _configurationMenu->render();
         _graphMenu->render(_selectedPrimitive);
         _topLeftMenu->render();
+#ifdef GL_STATS_ENABLED
+        _glStatsMenu->renderMenu();
+#endif
         _sceneMenu->renderMenu(_sceneMenuPosition.x, _sceneMenuPosition.y);
         _bezierSurfaceMenu->render();
         _catmullRomMenu->render();
+        if (_showProfiler)
+            _profilerMenu->renderMenu();
 
         ImGui::Render();
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+#ifdef GL_STATS_ENABLED
+        GlStatsMenu::recordDrawData(*ImGui::GetDrawData());
+#endif
     }
 
     if (!_showImgui) {
@@ -275,6 +529,8 @@ void Application::handleKey() {
             _showImgui = !_showImgui;
             _logger.info("Visibility toggled: {}", _showImgui ? "on" : "off");
         }
+        if (key == GLFW_KEY_P && (mods & GLFW_MOD_CONTROL))
+            _showProfiler = !_showProfiler;
 
         if (_primitiveMenuPosition.x != -1.0f && _primitiveMenuPosition.y != -1.0f) {
             if (key == GLFW_KEY_UP)
@@ -289,7 +545,7 @@ void Application::handleKey() {
     });
 }
 
-void Application::takeScreenshot() const {
+void Application::takeScreenshot() {
     const auto now = std::chrono::system_clock::now();
     const auto timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
     const std::string filename = "screenshots/screenshot_" + std::to_string(timestamp) + ".png";
@@ -297,15 +553,9 @@ void Application::takeScreenshot() const {
     int height;
 
     glfwGetFramebufferSize(_window.getWindowInstance(), &width, &height);
-    std::vector<unsigned char> pixels(width * height * 3);
-    std::vector<unsigned char> flippedPixels(width * height * 3);
-
-    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixels.data());
-    for (int y = 0; y < height; y++)
-        memcpy(&flippedPixels[y * width * 3], &pixels[(height - 1 - y) * width * 3], width * 3);
     std::filesystem::create_directory("screenshots");
-    stbi_write_png(filename.c_str(), width, height, 3, flippedPixels.data(), width * 3);
-    _logger.info("Screenshot saved to: {}", filename);
+    _readback->request(0, width, height, filename);
+    _logger.info("Screenshot queued to: {}", filename);
 }
 
 void Application::handleLeftClick(const Coordinates &coordinates) {
@@ -313,7 +563,7 @@ void Application::handleLeftClick(const Coordinates &coordinates) {
         _primitiveMenuPosition = glm::vec2(-1.0f);
         _modelMenuPosition = glm::vec2(-1.0f);
     }
-    _selectedPrimitive = Intersection::findNearestPrimitive(_primitives, _window, coordinates);
+    _selectedPrimitive = Intersection::findNearestPrimitive(_window, coordinates);
 }
 
 void Application::handleRightClick(const Coordinates &coordinates, const int mods) {
@@ -331,10 +581,13 @@ void Application::deletePrimitive(const PrimitivePtr &primitive) {
     _selectedPrimitive = nullptr;
     _configurationMenu->updateSelectedPrimitive(nullptr);
     if (primitive == nullptr) return;
+    // Menus may still hold it for a while, it must stop being drawn now
+    primitive->setActive(false);
     _primitives.erase(std::ranges::find(_primitives, primitive));
 }
 
 Application::~Application() {
+    EventLog::getInstance().close();
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
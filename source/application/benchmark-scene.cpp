@@ -0,0 +1,81 @@
+// Header File Include //
+#include "application/benchmark-scene.hpp"
+#include "application/light-repository.hpp"
+#include "application/primitive-factory.hpp"
+#include "pipeline/model.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <cmath>
+#include <format>
+
+constexpr float GRID_SPACING = 3.0f;
+constexpr PrimitiveType SHAPE_TYPES[] = {CUBE, SPHERE, CYLINDER, CONE};
+
+PrimitiveList BenchmarkScene::build() const {
+    LightRepository &lightRepository = LightRepository::getInstance();
+    const int columns = std::max(static_cast<int>(std::ceil(std::sqrt(static_cast<float>(shapes)))), 1);
+    const auto gridPosition = [columns](const int index, const float height) {
+        return glm::vec3((static_cast<float>(index % columns) - static_cast<float>(columns) / 2.0f) * GRID_SPACING,
+                         height, -5.0f - static_cast<float>(index / columns) * GRID_SPACING);
+    };
+    PrimitiveList primitives;
+
+    for (int index = 0; index < shapes; index++) {
+        const auto shape = PrimitiveFactory::createPrimitive(SHAPE_TYPES[index % std::size(SHAPE_TYPES)]);
+        const float hue = static_cast<float>(index % 7) / 7.0f;
+
+        shape->translate(gridPosition(index, -3.0f));
+        shape->setColor(glm::vec3(hue, 1.0f - hue, 0.5f));
+        shape->setRoughness(static_cast<float>(index % 5) / 4.0f);
+        shape->setMetallic(static_cast<float>(index % 2));
+        primitives.push_back(shape);
+    }
+
+    while (!lightRepository.getPointLights().empty())
+        lightRepository.removePointLight(lightRepository.getPointLights().size() - 1);
+    for (int index = 0; index < pointLights; index++) {
+        const float hue = static_cast<float>(index % 3) / 3.0f;
+
+        lightRepository.addPointLight({gridPosition(index * std::max(shapes / std::max(pointLights, 1), 1), 0.0f),
+                                       glm::vec3(0), glm::vec3(1.0f - hue, hue, 0.5f)});
+    }
+
+    for (int index = 0; index < models; index++) {
+        const auto model = std::make_shared<Model>("resources/object/backpack/backpack.obj");
+
+        model->translate(glm::vec3(static_cast<float>(index) * 4.0f - static_cast<float>(models) * 2.0f, 0.0f, -2.0f));
+        model->scale(0.5f);
+        primitives.push_back(model);
+    }
+
+    const auto bezierSurface = std::dynamic_pointer_cast<BezierSurface>(
+        PrimitiveFactory::createPrimitive(BEZIER_SURFACE));
+    const auto catmullRomCurve = std::dynamic_pointer_cast<CatmullRomCurve>(
+        PrimitiveFactory::createPrimitive(CATMULL_ROM_CURVE));
+    std::vector<glm::vec3> controlPoints;
+
+    for (int index = 0; index < 8; index++)
+        controlPoints.emplace_back(static_cast<float>(index) * 2.0f - 7.0f, std::sin(static_cast<float>(index)), 0.0f);
+    bezierSurface->setResolution(patchResolution, patchResolution);
+    bezierSurface->translate(glm::vec3(-10, -3, 0));
+    catmullRomCurve->setControlPoints(controlPoints);
+    catmullRomCurve->setResolution(patchResolution);
+    catmullRomCurve->translate(glm::vec3(0, 4, 0));
+    primitives.push_back(bezierSurface);
+    primitives.push_back(catmullRomCurve);
+    return primitives;
+}
+
+std::string BenchmarkScene::describe() const {
+    return std::format("\"scene\": \"{}\", \"shapes\": {}, \"pointLights\": {}, \"models\": {}, "
+                       "\"patchResolution\": {}", name, shapes, pointLights, models, patchResolution);
+}
+
+std::vector<BenchmarkScene> BenchmarkScene::getDefaultScenes() {
+    return {
+        {"small", 64, 4, 1, 32},
+        {"medium", 512, 32, 2, 64},
+        {"large", 2048, 128, 4, 128},
+    };
+}
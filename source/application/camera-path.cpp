@@ -0,0 +1,42 @@
+// Header File Include //
+#include "application/camera-path.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+CameraPath::CameraPath(const std::string &path) {
+    std::ifstream file(path);
+    std::string line;
+
+    if (path.empty())
+        return;
+    if (!file.is_open()) {
+        _logger.warn("Cannot open camera path {}, the default camera is used", path);
+        return;
+    }
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        CameraKey key{};
+
+        if (line.empty() || line.front() == '#')
+            continue;
+        if (stream >> key.position.x >> key.position.y >> key.position.z >> key.yaw >> key.pitch)
+            _keys.push_back(key);
+        else
+            _logger.warn("Skipping malformed camera key: {}", line);
+    }
+    _logger.info("Loaded {} camera keys from {}", _keys.size(), path);
+}
+
+CameraKey CameraPath::sample(const float progress) const {
+    const float position = std::clamp(progress, 0.0f, 1.0f) * static_cast<float>(_keys.size() - 1);
+    const auto index = std::min(static_cast<size_t>(position), _keys.size() - 1);
+    const CameraKey &from = _keys[index];
+    const CameraKey &to = _keys[std::min(index + 1, _keys.size() - 1)];
+    const float ratio = position - static_cast<float>(index);
+
+    return {glm::mix(from.position, to.position, ratio), glm::mix(from.yaw, to.yaw, ratio),
+            glm::mix(from.pitch, to.pitch, ratio)};
+}
@@ -0,0 +1,189 @@
+// Header File Include //
+#include "application/event-log.hpp"
+#include "application/frame-stats.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+bool EventLog::open(const std::filesystem::path &path) {
+    std::error_code error;
+
+    close();
+    if (path.has_parent_path())
+        std::filesystem::create_directories(path.parent_path(), error);
+    _path = path;
+    _segment = 0;
+    _start = std::chrono::steady_clock::now();
+    _startTime = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    if (!openSegment())
+        return false;
+    _pending.clear();
+    _pending.reserve(BUFFER_LIMIT);
+    _dropped = 0;
+    _stopping = false;
+    _open.store(true, std::memory_order_release);
+    _writer = std::thread(&EventLog::write, this);
+    return true;
+}
+
+void EventLog::close() {
+    if (!_writer.joinable())
+        return;
+    _open.store(false, std::memory_order_relaxed);
+    {
+        std::lock_guard lock(_mutex);
+
+        _stopping = true;
+    }
+    _wake.notify_one();
+    _writer.join();
+    closeSegment();
+}
+
+bool EventLog::openSegment() {
+    const std::filesystem::path path = _path.parent_path() / std::format("{}-{:04}{}", _path.stem().string(),
+                                                                          _segment, _path.extension().string());
+    const EventFileHeader header{EVENT_FILE_MAGIC, EVENT_FILE_VERSION, _segment, _startTime};
+
+    _file = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (_file < 0 || ftruncate(_file, SEGMENT_SIZE) != 0) {
+        _logger.error("Cannot create event log {}: {}", path.string(), std::strerror(errno));
+        closeSegment();
+        return false;
+    }
+    void *mapping = mmap(nullptr, SEGMENT_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, _file, 0);
+
+    if (mapping == MAP_FAILED) {
+        _logger.error("Cannot map event log {}: {}", path.string(), std::strerror(errno));
+        closeSegment();
+        return false;
+    }
+    _mapping = static_cast<std::byte *>(mapping);
+    std::memcpy(_mapping, &header, sizeof(header));
+    _offset = sizeof(header);
+    _segmentStart = std::chrono::steady_clock::now();
+    _logger.info("Recording telemetry events to {}", path.string());
+    return true;
+}
+
+void EventLog::closeSegment() {
+    if (_mapping != nullptr)
+        munmap(_mapping, SEGMENT_SIZE);
+    if (_file >= 0 && ftruncate(_file, static_cast<off_t>(_offset)) != 0)
+        _logger.warn("Cannot trim event log segment {}: {}", _segment, std::strerror(errno));
+    if (_file >= 0)
+        ::close(_file);
+    _mapping = nullptr;
+    _file = -1;
+    _offset = 0;
+    _segment++;
+}
+
+void EventLog::record(const EventType type, const std::initializer_list<double> values, const std::string_view name,
+                      const uint32_t frame) {
+    if (!isOpen())
+        return;
+    const size_t valueCount = std::min<size_t>(values.size(), MAX_EVENT_VALUES);
+    const size_t nameLength = std::min<size_t>(name.size(), MAX_EVENT_NAME);
+    const size_t size = (sizeof(EventHeader) + valueCount * sizeof(double) + nameLength + 7) & ~size_t{7};
+    const EventHeader header{
+        static_cast<uint16_t>(size), type, static_cast<uint8_t>(valueCount), frame == CURRENT_FRAME ? getFrame() : frame,
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - _start).count())
+    };
+    std::lock_guard lock(_mutex);
+    const size_t offset = _pending.size();
+
+    if (offset + size > BUFFER_LIMIT) {
+        _dropped++;
+        return;
+    }
+    // The padding after the name comes zeroed from resize
+    _pending.resize(offset + size);
+    std::byte *output = _pending.data() + offset;
+    std::memcpy(output, &header, sizeof(header));
+    std::memcpy(output + sizeof(header), values.begin(), valueCount * sizeof(double));
+    std::memcpy(output + sizeof(header) + valueCount * sizeof(double), name.data(), nameLength);
+    if (offset < BUFFER_LIMIT / 2 && offset + size >= BUFFER_LIMIT / 2)
+        _wake.notify_one();
+}
+
+void EventLog::append(std::span<const std::byte> records) {
+    while (!records.empty() && _mapping != nullptr) {
+        size_t length = records.size();
+
+        // A record never straddles two segments, only whole records go in when the batch does not fit
+        if (_offset + length > SEGMENT_SIZE) {
+            length = 0;
+            while (length < records.size()) {
+                uint16_t size;
+
+                std::memcpy(&size, records.data() + length, sizeof(size));
+                if (_offset + length + size > SEGMENT_SIZE)
+                    break;
+                length += size;
+            }
+        }
+        std::memcpy(_mapping + _offset, records.data(), length);
+        _offset += length;
+        records = records.subspan(length);
+        if (!records.empty()) {
+            closeSegment();
+            if (!openSegment())
+                _open.store(false, std::memory_order_relaxed);
+        }
+    }
+}
+
+void EventLog::write() {
+    std::vector<std::byte> batch;
+    auto lastMemory = std::chrono::steady_clock::time_point();
+
+    batch.reserve(BUFFER_LIMIT);
+    while (true) {
+        const auto now = std::chrono::steady_clock::now();
+        bool stopping;
+        size_t dropped;
+
+        // Sampled here rather than on the frame, reading the process status is far from free
+        if (now - lastMemory >= MEMORY_INTERVAL) {
+            const MemoryUsage memory = readMemoryUsage();
+
+            record(MEMORY_EVENT, {static_cast<double>(memory.residentKb), static_cast<double>(memory.peakKb)});
+            lastMemory = now;
+        }
+        {
+            std::unique_lock lock(_mutex);
+
+            _wake.wait_for(lock, FLUSH_INTERVAL, [this] {
+                return _stopping || _pending.size() >= BUFFER_LIMIT / 2;
+            });
+            batch.swap(_pending);
+            stopping = _stopping;
+            dropped = std::exchange(_dropped, 0);
+        }
+        append(batch);
+        batch.clear();
+        if (dropped > 0)
+            _logger.warn("{} telemetry events dropped, the event log writer fell behind", dropped);
+        if (stopping)
+            return;
+        if (_mapping != nullptr && std::chrono::steady_clock::now() - _segmentStart >= ROTATION_INTERVAL) {
+            closeSegment();
+            if (!openSegment())
+                _open.store(false, std::memory_order_relaxed);
+        }
+    }
+}
+
+EventLog::~EventLog() {
+    close();
+}
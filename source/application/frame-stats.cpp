@@ -0,0 +1,101 @@
+// Header File Include //
+#include "application/frame-stats.hpp"
+#include "pipeline/gpu-profiler.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <fstream>
+#include <numeric>
+
+#include <sys/resource.h>
+
+MemoryUsage readMemoryUsage() {
+    MemoryUsage usage;
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    rusage resources{};
+
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmRSS:"))
+            usage.residentKb = std::stol(line.substr(6));
+        else if (line.starts_with("VmHWM:"))
+            usage.peakKb = std::stol(line.substr(6));
+    }
+    if (usage.peakKb == 0 && getrusage(RUSAGE_SELF, &resources) == 0) {
+#ifdef __APPLE__
+        usage.peakKb = resources.ru_maxrss / 1024;
+#else
+        usage.peakKb = resources.ru_maxrss;
+#endif
+    }
+    return usage;
+}
+
+void FrameStats::record(const double milliseconds) {
+    _frameTimes.push_back(milliseconds);
+#ifdef GL_STATS_ENABLED
+    _glTotals.add(GlStats::getInstance().getCurrentFrameTotal());
+#endif
+}
+
+double FrameStats::getMean() const {
+    if (_frameTimes.empty())
+        return 0.0;
+    return std::accumulate(_frameTimes.begin(), _frameTimes.end(), 0.0) / static_cast<double>(_frameTimes.size());
+}
+
+double FrameStats::getPercentile(const double ratio) const {
+    std::vector<double> sorted = _frameTimes;
+
+    if (sorted.empty())
+        return 0.0;
+    std::ranges::sort(sorted);
+    return sorted[std::min(static_cast<size_t>(ratio * static_cast<double>(sorted.size())), sorted.size() - 1)];
+}
+
+std::string FrameStats::toJson(const std::string &indent) const {
+    const std::vector<std::pair<std::string, GpuZoneStats>> gpuZones = GpuProfiler::getInstance().getStats();
+    const double frames = static_cast<double>(std::max<size_t>(_frameTimes.size(), 1));
+    const MemoryUsage memory = readMemoryUsage();
+    std::string json = "{\n";
+
+    json += std::format("{}  \"frames\": {},\n", indent, _frameTimes.size());
+    json += std::format("{}  \"frameTimeMs\": {{\"mean\": {:.4f}, \"min\": {:.4f}, \"max\": {:.4f}, "
+                        "\"p50\": {:.4f}, \"p95\": {:.4f}, \"p99\": {:.4f}}},\n", indent, getMean(),
+                        getPercentile(0.0), getPercentile(1.0), getPercentile(0.50), getPercentile(0.95),
+                        getPercentile(0.99));
+    json += std::format("{}  \"fps\": {:.2f},\n", indent, getMean() > 0.0 ? 1000.0 / getMean() : 0.0);
+#ifdef GL_STATS_ENABLED
+    json += std::format("{}  \"perFrame\": {{\"glCalls\": {:.1f}, \"drawCalls\": {:.1f}, \"triangles\": {:.1f}, "
+                        "\"vertices\": {:.1f}, \"bufferBytes\": {:.1f}}},\n", indent,
+                        static_cast<double>(_glTotals.glCalls) / frames,
+                        static_cast<double>(_glTotals.drawCalls) / frames,
+                        static_cast<double>(_glTotals.triangles) / frames,
+                        static_cast<double>(_glTotals.vertices) / frames,
+                        static_cast<double>(_glTotals.bufferBytes) / frames);
+#endif
+    json += std::format("{}  \"memoryKb\": {{\"resident\": {}, \"peak\": {}}},\n", indent, memory.residentKb,
+                        memory.peakKb);
+    json += std::format("{}  \"gpuPassesMs\": {{", indent);
+    for (size_t index = 0; index < gpuZones.size(); index++) {
+        const auto &[name, zone] = gpuZones[index];
+
+        json += std::format("{}\n{}    \"{}\": {{\"mean\": {:.4f}, \"p50\": {:.4f}, \"p95\": {:.4f}, \"p99\": {:.4f}}}",
+                            index == 0 ? "" : ",", indent, name, zone.average, zone.p50, zone.p95, zone.p99);
+    }
+    json += gpuZones.empty() ? "}\n" : std::format("\n{}  }}\n", indent);
+    return json + indent + "}";
+}
+
+bool FrameStats::write(const std::filesystem::path &path) const {
+    std::ofstream file(path, std::ios::trunc);
+
+    if (!file.is_open()) {
+        _logger.error("Cannot write frame statistics to {}", path.string());
+        return false;
+    }
+    file << toJson() << "\n";
+    _logger.info("{} frames: mean {:.3f} ms, p95 {:.3f} ms, p99 {:.3f} ms, written to {}", _frameTimes.size(),
+                 getMean(), getPercentile(0.95), getPercentile(0.99), path.string());
+    return true;
+}
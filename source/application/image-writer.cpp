@@ -0,0 +1,58 @@
+// Header File Include //
+#include "application/image-writer.hpp"
+#include "application/profiler.hpp"
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "stb_image_write.h"
+
+// STD Include //
+#include <utility>
+
+ImageWriter::ImageWriter() : _worker(&ImageWriter::work, this) {
+}
+
+void ImageWriter::submit(ImageJob job) {
+    std::unique_lock lock(_mutex);
+
+    _spaceAvailable.wait(lock, [this] { return _queue.size() < QUEUE_CAPACITY; });
+    _queue.push_back(std::move(job));
+    lock.unlock();
+    _jobAvailable.notify_one();
+}
+
+void ImageWriter::work() {
+    Profiler::getInstance().setThreadName("Image writer");
+    while (true) {
+        std::unique_lock lock(_mutex);
+
+        _jobAvailable.wait(lock, [this] { return _stopping || !_queue.empty(); });
+        if (_queue.empty())
+            return;
+        const ImageJob job = std::move(_queue.front());
+
+        _queue.pop_front();
+        lock.unlock();
+        _spaceAvailable.notify_one();
+        encode(job);
+    }
+}
+
+// GL rows start at the bottom, pointing at the last row with a negative stride flips the image while encoding
+void ImageWriter::encode(const ImageJob &job) const {
+    PROFILE_ZONE("Encode PNG");
+    const int stride = job.width * 3;
+    const unsigned char *lastRow = job.pixels.data() + static_cast<size_t>(job.height - 1) * stride;
+
+    if (!stbi_write_png(job.filename.c_str(), job.width, job.height, 3, lastRow, -stride))
+        _logger.error("Cannot write image {}", job.filename);
+}
+
+ImageWriter::~ImageWriter() {
+    {
+        std::lock_guard lock(_mutex);
+
+        _stopping = true;
+    }
+    _jobAvailable.notify_one();
+    _worker.join();
+}
@@ -0,0 +1,145 @@
+// Header File Include //
+#include "application/logger.hpp"
+
+// STD Include //
+#include <cstdio>
+#include <ctime>
+#include <string>
+
+static void appendTimestamp(std::string &output, const std::chrono::system_clock::time_point time) {
+    static time_t cachedSecond = -1;
+    static char cachedText[80];
+    const time_t second = std::chrono::system_clock::to_time_t(time);
+
+    // Most records of a batch share their second, localtime and strftime only run when it changes
+    if (second != cachedSecond) {
+        tm local{};
+
+        localtime_r(&second, &local);
+        strftime(cachedText, sizeof(cachedText), "%Y-%m-%d.%X", &local);
+        cachedSecond = second;
+    }
+    output += '[';
+    output += cachedText;
+    output += "] ";
+}
+
+static void appendRecord(std::string &output, const LogRecord &record) {
+    appendTimestamp(output, record.time);
+    output += logLevelColors[record.level];
+    output += logLevelNames[record.level];
+    output += "\e[0m ";
+    if (record.overflow != nullptr)
+        output += *record.overflow;
+    else
+        output.append(record.message, record.length);
+    output += '\n';
+}
+
+LogBackend::LogBackend() : _slots(std::make_unique<Slot[]>(CAPACITY)) {
+    for (size_t index = 0; index < CAPACITY; index++)
+        _slots[index].sequence.store(index, std::memory_order_relaxed);
+    _writer = std::thread(&LogBackend::write, this);
+}
+
+LogRecord *LogBackend::acquire(const LogLevel level) {
+    size_t position = _enqueuePosition.load(std::memory_order_relaxed);
+
+    while (true) {
+        Slot &slot = _slots[position % CAPACITY];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+
+        if (difference == 0) {
+            if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                slot.record.position = position;
+                return &slot.record;
+            }
+        } else if (difference < 0) {
+            if (level < WARN) {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            std::this_thread::yield();
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void LogBackend::publish(const LogRecord &record) {
+    _slots[record.position % CAPACITY].sequence.store(record.position + 1, std::memory_order_release);
+}
+
+void LogBackend::flush() {
+    const size_t target = _enqueuePosition.load(std::memory_order_acquire);
+
+    while (_writtenPosition.load(std::memory_order_acquire) < target)
+        std::this_thread::yield();
+}
+
+void LogBackend::writeNow(const LogRecord &record) {
+    std::string output;
+
+    appendRecord(output, record);
+    delete record.overflow;
+    std::fwrite(output.data(), 1, output.size(), record.level >= ERROR ? stderr : stdout);
+}
+
+// Records are taken in order, a stream switch between stdout and stderr writes the pending part first
+void LogBackend::write() {
+    std::string output;
+    FILE *stream = stdout;
+    size_t position = 0;
+    const auto flushOutput = [&] {
+        if (output.empty())
+            return;
+        std::fwrite(output.data(), 1, output.size(), stream);
+        std::fflush(stream);
+        output.clear();
+    };
+
+    while (true) {
+        Slot &slot = _slots[position % CAPACITY];
+
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            const bool stopping = _stopping.load(std::memory_order_acquire);
+
+            if (const size_t dropped = _dropped.exchange(0, std::memory_order_relaxed); dropped > 0) {
+                LogRecord notice{std::chrono::system_clock::now(), 0, WARN, 0, nullptr, {}};
+
+                notice.length = static_cast<unsigned>(
+                    std::format_to_n(notice.message, LOG_MESSAGE_SIZE, "{} log records dropped, the queue was full",
+                                     dropped).size);
+                if (stream != stdout)
+                    flushOutput();
+                stream = stdout;
+                appendRecord(output, notice);
+            }
+            flushOutput();
+            _writtenPosition.store(position, std::memory_order_release);
+            // Every producer published before the destructor asked to stop, an empty ring is the end
+            if (stopping)
+                return;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            continue;
+        }
+        FILE *recordStream = slot.record.level >= ERROR ? stderr : stdout;
+
+        if (recordStream != stream) {
+            flushOutput();
+            stream = recordStream;
+        }
+        appendRecord(output, slot.record);
+        delete slot.record.overflow;
+        slot.sequence.store(position + CAPACITY, std::memory_order_release);
+        position++;
+    }
+}
+
+LogBackend::~LogBackend() {
+    _stopping.store(true, std::memory_order_release);
+    _writer.join();
+    closed = true;
+}
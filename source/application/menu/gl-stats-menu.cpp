@@ -0,0 +1,71 @@
+#include <imgui.h>
+
+#include "application/menu/gl-stats-menu.hpp"
+#include "application/menu/lateral-menu.hpp"
+
+#ifdef GL_STATS_ENABLED
+
+void GlStatsMenu::renderMenu() const {
+    const ImGuiIO &io = ImGui::GetIO();
+    const GlPassCounters &passes = GlStats::getInstance().getLastFrame();
+    GlCounters total;
+    const auto renderRow = [](const char *name, const GlCounters &counters) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name);
+        for (const uint64_t value: {counters.drawCalls, counters.triangles, counters.vertices, counters.programBinds,
+                                    counters.textureBinds, counters.vertexArrayBinds, counters.uniformUploads,
+                                    counters.glCalls}) {
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(value));
+        }
+        ImGui::TableNextColumn();
+        ImGui::Text("%.1f", static_cast<double>(counters.bufferBytes) / 1024.0);
+    };
+
+    ImGui::SetNextWindowSize(ImVec2(WIDTH, io.DisplaySize.y / 3.8f));
+    ImGui::SetNextWindowPos(ImVec2(TopLeftMenu::WIDTH, 0));
+    ImGui::Begin("GL Statistics", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse);
+    if (ImGui::BeginTable("Passes", 10, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders |
+                                        ImGuiTableFlags_SizingFixedFit)) {
+        ImGui::TableSetupColumn("Pass");
+        ImGui::TableSetupColumn("Draws");
+        ImGui::TableSetupColumn("Triangles");
+        ImGui::TableSetupColumn("Vertices");
+        ImGui::TableSetupColumn("Programs");
+        ImGui::TableSetupColumn("Textures");
+        ImGui::TableSetupColumn("VAOs");
+        ImGui::TableSetupColumn("Uniforms");
+        ImGui::TableSetupColumn("GL calls");
+        ImGui::TableSetupColumn("Upload (KB)");
+        ImGui::TableHeadersRow();
+        for (int pass = 0; pass < GL_PASS_COUNT; pass++) {
+            renderRow(glPassNames[pass], passes[pass]);
+            total.add(passes[pass]);
+        }
+        renderRow("Total", total);
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+void GlStatsMenu::recordDrawData(const ImDrawData &drawData) {
+    GlCounters counters;
+
+    for (const ImDrawList *drawList: drawData.CmdLists) {
+        for (const ImDrawCmd &command: drawList->CmdBuffer) {
+            if (command.UserCallback != nullptr)
+                continue;
+            counters.drawCalls++;
+            counters.textureBinds++;
+            counters.vertices += command.ElemCount;
+            counters.triangles += command.ElemCount / 3;
+        }
+        counters.bufferBytes += drawList->VtxBuffer.Size * sizeof(ImDrawVert) +
+                                drawList->IdxBuffer.Size * sizeof(ImDrawIdx);
+    }
+    counters.glCalls = counters.drawCalls;
+    GlStats::getInstance().add(UI_PASS, counters);
+}
+
+#endif
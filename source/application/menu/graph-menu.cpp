@@ -1,7 +1,17 @@
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
 #include "application/menu/graph-menu.hpp"
 
 Folder::Folder(const std::string &name, FolderPtr parent)
-    : name(name), parent(parent) {}
+    : name(name), parent(parent), node(SceneStore::getInstance().create(nullptr)) {
+    if (parent)
+        SceneStore::getInstance().setParent(node, parent->node);
+}
+
+Folder::~Folder() {
+    SceneStore::getInstance().destroy(node);
+}
 
 GraphMenu::GraphMenu(Window &window, std::vector<PrimitivePtr> &primitiveList) :
     LowerLateralMenu("Graph Scene"), _window(window), _primitiveList(primitiveList), _folderToRename(nullptr), _selectedFolder(nullptr) {
@@ -13,6 +23,8 @@ GraphMenu::GraphMenu(Window &window, std::vector<PrimitivePtr> &primitiveList) :
 void GraphMenu::renderMenu(PrimitivePtr &selectedPrimitive) {
     updatePrimitives();
     renderFolder(_rootFolder, selectedPrimitive);
+    if (_selectedFolder)
+        renderFolderTransform(_selectedFolder);
 
     if (_folderToRename) {
         ImGui::OpenPopup("Rename Folder");
@@ -116,6 +128,20 @@ void GraphMenu::renderFolderSelectionPopup(FolderPtr folder, PrimitivePtr primit
     }
 }
 
+void GraphMenu::renderFolderTransform(FolderPtr folder) {
+    ImGui::Separator();
+    ImGui::Text("%s transform", folder->name.c_str());
+    bool changed = ImGui::DragFloat3("Position", &folder->position.x, 0.05f);
+    changed |= ImGui::DragFloat3("Rotation", &folder->rotation.x, 0.5f);
+    changed |= ImGui::DragFloat3("Scale", &folder->scale.x, 0.01f);
+
+    if (changed) {
+        SceneStore::getInstance().setLocal(folder->node, glm::translate(glm::mat4(1.0f), folder->position)
+                                                         * mat4_cast(glm::quat(radians(folder->rotation)))
+                                                         * glm::scale(glm::mat4(1.0f), folder->scale));
+    }
+}
+
 void GraphMenu::createFolder(const std::string &name, FolderPtr parent) {
     auto newFolder = std::make_shared<Folder>(name, parent);
     parent->subfolders.push_back(newFolder);
@@ -129,11 +155,21 @@ void GraphMenu::renameFolder(FolderPtr folder) {
 void GraphMenu::deleteFolder(FolderPtr folder) {
     if (folder->parent) {
         for (auto &primitive : folder->primitives) {
+            primitive->setParent(folder->parent->node);
             folder->parent->primitives.push_back(primitive);
         }
+        for (auto &subfolder : folder->subfolders) {
+            subfolder->parent = folder->parent;
+            SceneStore::getInstance().setParent(subfolder->node, folder->parent->node);
+            folder->parent->subfolders.push_back(subfolder);
+        }
 
         auto &subfolders = folder->parent->subfolders;
         subfolders.erase(std::remove(subfolders.begin(), subfolders.end(), folder), subfolders.end());
+        if (_selectedFolder == folder)
+            _selectedFolder = folder->parent;
+        folder->subfolders.clear();
+        folder->primitives.clear();
     } else {
         folder->primitives.clear();
     }
@@ -146,6 +182,7 @@ void GraphMenu::movePrimitiveToFolder(PrimitivePtr primitive, FolderPtr targetFo
     }
 
     targetFolder->primitives.push_back(primitive);
+    primitive->setParent(targetFolder->node);
 }
 
 std::vector<FolderPtr> GraphMenu::getAllFolders(FolderPtr folder) {
@@ -171,6 +208,7 @@ void GraphMenu::updatePrimitives() {
         }
         if (!found) {
             _rootFolder->primitives.push_back(primitive);
+            primitive->setParent(_rootFolder->node);
         }
     }
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "application/menu/illumination-menu.hpp"
+#include "pipeline/render-settings.hpp"
 
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
@@ -8,20 +9,32 @@
 IlluminationTypeMenu::IlluminationTypeMenu() : LowerMenu("Illumination Type") {
 }
 
-void IlluminationTypeMenu::renderMenu(Shader &textureShader) {
+void IlluminationTypeMenu::renderMenu(Shader &) {
+    RenderSettings &settings = RenderSettings::instance();
+    const RenderStats &stats = RenderStats::instance();
+
     ImGui::Text("Illumination Model:");
 
     const char* labels[] = { "Lambert", "Gouraud", "Phong", "Blinn-Phong", "PBR" };
 
     for (int i = 0; i < 5; ++i) {
-        bool selected = (_currentModel == i);
+        bool selected = (settings.illuminationModel == i);
         if (ImGui::Checkbox(labels[i], &selected)) {
             if (selected)
-                _currentModel = i;
+                settings.illuminationModel = i;
         }
+    }
 
-        if (selected && _currentModel != i)
-            _currentModel = i;
-        textureShader.setInt("illuminationModel", _currentModel);
+    ImGui::Separator();
+    ImGui::Checkbox("Deferred Shading", &settings.deferredShading);
+    ImGui::BeginDisabled(settings.deferredShading);
+    ImGui::Checkbox("Depth Pre-Pass", &settings.depthPrePass);
+    ImGui::EndDisabled();
+    ImGui::Checkbox("Frustum Culling", &settings.frustumCulling);
+    ImGui::Text("Drawn primitives: %u / %u", stats.visiblePrimitives, stats.scenePrimitives);
+
+    if (!settings.deferredShading) {
+        ImGui::Text("Depth pre-pass: %.3f ms", settings.depthPrePass ? stats.depthPrePassTime : 0.0f);
+        ImGui::Text("Shading pass: %.3f ms", stats.shadingPassTime);
     }
-}
\ No newline at end of file
+}
@@ -65,6 +65,6 @@ void TopMenu::render() {
     ImGui::SetNextWindowSize(ImVec2(io.DisplaySize.x / 3, io.DisplaySize.y / 4));
     ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x / 3, 0));
     ImGui::Begin(_title.c_str(), nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoCollapse);
-    renderMenu(LightRepository::getInstance().getPointLights());
+    renderMenu(LightRepository::getInstance());
     ImGui::End();
 }
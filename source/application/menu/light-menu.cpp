@@ -5,12 +5,13 @@
 
 LightMenu::LightMenu() : TopMenu("Light Manager") {}
 
-void LightMenu::renderMenu(std::vector<Light> &pointLights) {
+void LightMenu::renderMenu(LightRepository &lightRepository) {
+    const std::vector<Light> &pointLights = lightRepository.getPointLights();
     static size_t selectedLight = -1;
     ImGui::BeginChild("Light List", ImVec2(150, 0), true);
 
     if (ImGui::Button("+ Add Light")) {
-        pointLights.push_back({
+        lightRepository.addPointLight({
             glm::vec3(0, 1, 0),
             glm::vec3(0),
             glm::vec3(1, 1, 1)
@@ -34,18 +35,22 @@ void LightMenu::renderMenu(std::vector<Light> &pointLights) {
     ImGui::BeginChild("Light Properties", ImVec2(0, -ImGui::GetFrameHeightWithSpacing()));
     
     if (selectedLight != static_cast<size_t>(-1) && selectedLight < pointLights.size()) {
-        Light& light = pointLights[selectedLight];
-        
+        Light light = pointLights[selectedLight];
+        bool changed = false;
+
         // Position controls
         ImGui::Text("Position");
-        ImGui::DragFloat("X", &light.position.x, 0.1f);
-        ImGui::DragFloat("Y", &light.position.y, 0.1f);
-        ImGui::DragFloat("Z", &light.position.z, 0.1f);
-        
+        changed |= ImGui::DragFloat("X", &light.position.x, 0.1f);
+        changed |= ImGui::DragFloat("Y", &light.position.y, 0.1f);
+        changed |= ImGui::DragFloat("Z", &light.position.z, 0.1f);
+
         // Color controls
         ImGui::Text("Color");
-        ImGui::ColorEdit3("Color", &light.color.r);
-        
+        changed |= ImGui::ColorEdit3("Color", &light.color.r);
+
+        if (changed)
+            lightRepository.updatePointLight(selectedLight, light);
+
     } else {
         ImGui::Text("Select a light or create a new one");
     }
@@ -54,7 +59,7 @@ void LightMenu::renderMenu(std::vector<Light> &pointLights) {
     
     if (selectedLight != static_cast<size_t>(-1) && selectedLight < pointLights.size()) {
         if (ImGui::Button("Delete Selected", ImVec2(-1, 0))) {
-            pointLights.erase(pointLights.begin() + selectedLight);
+            lightRepository.removePointLight(selectedLight);
             selectedLight = -1;
         }
     }
@@ -0,0 +1,158 @@
+#include <imgui.h>
+
+#include "application/menu/profiler-menu.hpp"
+#include "application/profiler.hpp"
+#include "pipeline/gpu-profiler.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <vector>
+
+void ProfilerMenu::renderMenu() {
+    Profiler &profiler = Profiler::getInstance();
+    bool enabled = profiler.isEnabled();
+    bool paused = profiler.isPaused();
+    const int frameCount = static_cast<int>(profiler.getFrames().size());
+
+    ImGui::SetNextWindowSize({700.0f, 360.0f}, ImGuiCond_Once);
+    ImGui::Begin("CPU Profiler", nullptr, ImGuiWindowFlags_NoSavedSettings);
+
+    if (ImGui::Checkbox("Enabled", &enabled))
+        profiler.setEnabled(enabled);
+    ImGui::SameLine();
+    if (ImGui::Checkbox("Pause", &paused))
+        profiler.setPaused(paused);
+    ImGui::SameLine();
+    if (ImGui::Button("Export Chrome Trace"))
+        profiler.exportChromeTrace(_exportPath);
+
+    if (frameCount == 0) {
+        ImGui::Text("No frame recorded");
+        ImGui::End();
+        return;
+    }
+    _frameOffset = std::clamp(_frameOffset, 0, frameCount - 1);
+    ImGui::SliderInt("Frames ago", &_frameOffset, 0, frameCount - 1);
+
+    renderTimeline();
+    ImGui::Separator();
+    renderZoneTable();
+    ImGui::Separator();
+    renderGpuTable();
+    ImGui::End();
+}
+
+// Flame view of one frame: a row per thread, nested zones stacked below their parent
+void ProfilerMenu::renderTimeline() const {
+    const Profiler &profiler = Profiler::getInstance();
+    const ProfileFrame &frame = profiler.getFrames()[profiler.getFrames().size() - 1 - _frameOffset];
+    const std::vector<std::string> threads = Profiler::getInstance().getThreadNames();
+    const double frameTicks = static_cast<double>(std::max<uint64_t>(frame.end - frame.start, 1));
+    std::vector<uint32_t> threadDepths(threads.size(), 0);
+    std::vector<float> threadOffsets(threads.size(), 0.0f);
+    ImDrawList *drawList = ImGui::GetWindowDrawList();
+    const float width = ImGui::GetContentRegionAvail().x;
+    float height = 0.0f;
+
+    ImGui::Text("Frame: %.3f ms", profiler.toMilliseconds(frame.end - frame.start));
+    for (const auto &[event, thread]: frame.samples)
+        threadDepths[thread] = std::max(threadDepths[thread], event.depth + 1);
+    for (size_t thread = 0; thread < threads.size(); thread++) {
+        threadOffsets[thread] = height + ImGui::GetTextLineHeightWithSpacing();
+        height = threadOffsets[thread] + static_cast<float>(threadDepths[thread]) * ROW_HEIGHT;
+    }
+
+    const ImVec2 timelineOrigin = ImGui::GetCursorScreenPos();
+    for (size_t thread = 0; thread < threads.size(); thread++)
+        drawList->AddText({timelineOrigin.x, timelineOrigin.y + threadOffsets[thread] - ImGui::GetTextLineHeight()},
+                          IM_COL32(200, 200, 200, 255), threads[thread].c_str());
+    for (const auto &[event, thread]: frame.samples) {
+        const uint64_t start = std::clamp(event.start, frame.start, frame.end) - frame.start;
+        const uint64_t end = std::clamp(event.end, frame.start, frame.end) - frame.start;
+        const float x0 = timelineOrigin.x + static_cast<float>(start / frameTicks) * width;
+        const float x1 = std::max(timelineOrigin.x + static_cast<float>(end / frameTicks) * width, x0 + 1.0f);
+        const float y0 = timelineOrigin.y + threadOffsets[thread] + static_cast<float>(event.depth) * ROW_HEIGHT;
+        const ImU32 color = ImColor::HSV(static_cast<float>(std::hash<const char *>{}(event.name) % 64) / 64.0f,
+                                         0.5f, 0.7f);
+
+        drawList->AddRectFilled({x0, y0}, {x1, y0 + ROW_HEIGHT - 1.0f}, color);
+        drawList->PushClipRect({x0, y0}, {x1, y0 + ROW_HEIGHT}, true);
+        drawList->AddText({x0 + 2.0f, y0 + 1.0f}, IM_COL32(255, 255, 255, 255), event.name);
+        drawList->PopClipRect();
+        if (ImGui::IsMouseHoveringRect({x0, y0}, {x1, y0 + ROW_HEIGHT}))
+            ImGui::SetTooltip("%s: %.3f ms", event.name, profiler.toMilliseconds(event.end - event.start));
+    }
+    ImGui::Dummy({width, height});
+}
+
+void ProfilerMenu::renderZoneTable() const {
+    struct ZoneStats {
+        double last = 0.0;
+        double total = 0.0;
+        double maximum = 0.0;
+        unsigned count = 0;
+    };
+    const Profiler &profiler = Profiler::getInstance();
+    const std::deque<ProfileFrame> &frames = profiler.getFrames();
+    std::map<std::string, ZoneStats> zones;
+
+    for (const ProfileFrame &frame: frames) {
+        for (const auto &[event, thread]: frame.samples) {
+            ZoneStats &stats = zones[event.name];
+            const double milliseconds = profiler.toMilliseconds(event.end - event.start);
+
+            stats.total += milliseconds;
+            stats.maximum = std::max(stats.maximum, milliseconds);
+            stats.count++;
+            if (&frame == &frames.back())
+                stats.last = milliseconds;
+        }
+    }
+
+    ImGui::Text("CPU");
+    if (!ImGui::BeginTable("Zones", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+        return;
+    ImGui::TableSetupColumn("Zone");
+    ImGui::TableSetupColumn("Last (ms)");
+    ImGui::TableSetupColumn("Average (ms)");
+    ImGui::TableSetupColumn("Max (ms)");
+    ImGui::TableHeadersRow();
+    for (const auto &[name, stats]: zones) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name.c_str());
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", stats.last);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", stats.total / stats.count);
+        ImGui::TableNextColumn();
+        ImGui::Text("%.3f", stats.maximum);
+    }
+    ImGui::EndTable();
+}
+
+void ProfilerMenu::renderGpuTable() {
+    const GpuProfiler &gpuProfiler = GpuProfiler::getInstance();
+
+    ImGui::Text("GPU (%u frames dropped)", gpuProfiler.getDroppedFrames());
+    if (!ImGui::BeginTable("GPU Zones", 6, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+        return;
+    ImGui::TableSetupColumn("Zone");
+    ImGui::TableSetupColumn("Last (ms)");
+    ImGui::TableSetupColumn("Average (ms)");
+    ImGui::TableSetupColumn("p50");
+    ImGui::TableSetupColumn("p95");
+    ImGui::TableSetupColumn("p99");
+    ImGui::TableHeadersRow();
+    for (const auto &[name, stats]: gpuProfiler.getStats()) {
+        ImGui::TableNextRow();
+        ImGui::TableNextColumn();
+        ImGui::TextUnformatted(name.c_str());
+        for (const float value: {stats.last, stats.average, stats.p50, stats.p95, stats.p99}) {
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", value);
+        }
+    }
+    ImGui::EndTable();
+}
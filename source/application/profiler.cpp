@@ -0,0 +1,146 @@
+// Header File Include //
+#include "application/profiler.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <fstream>
+#include <thread>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+ProfileRing::ProfileRing(const uint32_t id, std::string name) : id(id), name(std::move(name)) {
+}
+
+uint64_t ProfileRing::drain(std::vector<ProfileSample> &samples) {
+    const uint64_t head = _head.load(std::memory_order_acquire);
+    const uint64_t tail = _tail.load(std::memory_order_relaxed);
+
+    for (uint64_t index = tail; index < head; index++)
+        samples.push_back({_events[index & (CAPACITY - 1)], id});
+    // The copies are done before the slots are handed back to the producer
+    _tail.store(head, std::memory_order_release);
+    return _dropped.exchange(0, std::memory_order_relaxed);
+}
+
+Profiler::Profiler() : _tickOrigin(now()), _clockOrigin(std::chrono::steady_clock::now()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    calibrate();
+    _frameStart = now();
+}
+
+uint64_t Profiler::now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+// The tick rate is refined every frame against the steady clock, the longer the run the better the estimate
+void Profiler::calibrate() {
+    const uint64_t ticks = now() - _tickOrigin;
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - _clockOrigin);
+
+    if (ticks > 0 && elapsed.count() > 0.0)
+        _nanosecondsPerTick = elapsed.count() / static_cast<double>(ticks);
+}
+
+ProfileRing &Profiler::registerThread() {
+    const std::lock_guard lock(_registryMutex);
+    const auto id = static_cast<uint32_t>(_rings.size());
+
+    return *_rings.emplace_back(std::make_unique<ProfileRing>(id, id == 0 ? "Main" : "Thread " + std::to_string(id)));
+}
+
+ProfileRing &Profiler::getThreadRing() {
+    thread_local ProfileRing *ring = nullptr;
+
+    if (!ring)
+        ring = &registerThread();
+    return *ring;
+}
+
+void Profiler::setThreadName(const std::string &name) {
+    ProfileRing &ring = getThreadRing();
+    const std::lock_guard lock(_registryMutex);
+
+    ring.name = name;
+}
+
+std::vector<std::string> Profiler::getThreadNames() {
+    const std::lock_guard lock(_registryMutex);
+    std::vector<std::string> names;
+
+    for (const auto &ring: _rings)
+        names.push_back(ring->name);
+    return names;
+}
+
+void Profiler::beginFrame() {
+    const uint64_t frameEnd = now();
+    ProfileFrame frame{_frameStart, frameEnd, {}};
+    uint64_t dropped = 0;
+
+    _frameStart = frameEnd;
+    calibrate();
+    {
+        const std::lock_guard lock(_registryMutex);
+
+        for (const auto &ring: _rings)
+            dropped += ring->drain(frame.samples);
+    }
+    if (dropped > 0 && !_dropReported) {
+        _logger.warn("Profiler rings full, {} zones dropped, the frame recorded more than {} per thread", dropped,
+                     ProfileRing::CAPACITY);
+        _dropReported = true;
+    }
+    if (_paused || !isEnabled())
+        return;
+    _frames.push_back(std::move(frame));
+    while (_frames.size() > FRAME_HISTORY)
+        _frames.pop_front();
+}
+
+bool Profiler::exportChromeTrace(const std::filesystem::path &path) {
+    const std::vector<std::string> threads = getThreadNames();
+    std::ofstream file(path, std::ios::trunc);
+    const auto escape = [](const std::string &value) {
+        std::string escaped;
+
+        for (const char character: value) {
+            if (character == '"' || character == '\\')
+                escaped += '\\';
+            escaped += character;
+        }
+        return escaped;
+    };
+
+    if (!file.is_open() || _frames.empty()) {
+        _logger.warn("Cannot export profiler trace to {}", path.string());
+        return false;
+    }
+
+    const uint64_t origin = _frames.front().start;
+    const auto toMicroseconds = [this, origin](const uint64_t ticks) {
+        return toMilliseconds(ticks - std::min(ticks, origin)) * 1000.0;
+    };
+
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (size_t thread = 0; thread < threads.size(); thread++)
+        file << std::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"{}\"}}}},\n",
+                            thread, escape(threads[thread]));
+    for (const ProfileFrame &frame: _frames) {
+        for (const auto &[event, thread]: frame.samples)
+            file << std::format("{{\"name\":\"{}\",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":1,\"tid\":{},"
+                                "\"ts\":{:.3f},\"dur\":{:.3f}}},\n", escape(event.name), thread,
+                                toMicroseconds(event.start), toMilliseconds(event.end - event.start) * 1000.0);
+    }
+    file << std::format("{{\"name\":\"Export\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":{:.3f}}}\n]}}\n",
+                        toMicroseconds(_frames.back().end));
+    _logger.info("Profiler trace with {} frames exported to {}", _frames.size(), path.string());
+    return true;
+}
@@ -0,0 +1,53 @@
+// Header File Include //
+#include "application/run-options.hpp"
+#include "application/logger.hpp"
+
+// STD Include //
+#include <charconv>
+#include <string_view>
+
+RunOptions RunOptions::parse(const int argc, char **argv) {
+    const Logger &logger = Logger::getInstance();
+    RunOptions options;
+
+    for (int index = 1; index < argc; index++) {
+        const std::string_view argument = argv[index];
+        const size_t separator = argument.find('=');
+        const std::string_view name = argument.substr(0, separator);
+        const std::string_view value = separator == std::string_view::npos ? "" : argument.substr(separator + 1);
+        const auto readInt = [&](int &target) {
+            int parsed = 0;
+            const auto [end, error] = std::from_chars(value.data(), value.data() + value.size(), parsed);
+
+            if (error != std::errc() || end != value.data() + value.size() || parsed < 0) {
+                logger.warn("Ignoring {}: expected a positive integer", argument);
+                return;
+            }
+            target = parsed;
+        };
+
+        if (name == "--headless")
+            options.headless = true;
+        else if (name == "--bench")
+            options.headless = options.benchmark = true;
+        else if (name == "--frames")
+            readInt(options.frames);
+        else if (name == "--warmup")
+            readInt(options.warmupFrames);
+        else if (name == "--capture-every")
+            readInt(options.captureInterval);
+        else if (name == "--camera-path")
+            options.cameraPath = value;
+        else if (name == "--stats")
+            options.statsPath = value;
+        else if (name == "--capture-dir")
+            options.captureDirectory = value;
+        else if (name == "--record")
+            options.recordTarget = value;
+        else if (name == "--events")
+            options.eventLogPath = value;
+        else
+            logger.warn("Unknown option {}", argument);
+    }
+    return options;
+}
@@ -0,0 +1,120 @@
+// Header File Include //
+#include "application/video-writer.hpp"
+#include "application/profiler.hpp"
+
+// STD Include //
+#include <csignal>
+#include <format>
+#include <utility>
+
+VideoWriter::VideoWriter(const std::string &target, const int width, const int height, const int frameRate)
+    : _width(width & ~1), _height(height & ~1),
+      _planes(static_cast<size_t>(_width) * _height * 3 / 2) {
+    if (target.starts_with('|')) {
+        // A crashed encoder must surface as a write error, not take the application down with it
+        std::signal(SIGPIPE, SIG_IGN);
+        _output = popen(target.substr(1).c_str(), "w");
+        _pipe = true;
+    } else {
+        _output = std::fopen(target.c_str(), "wb");
+    }
+    if (_output == nullptr) {
+        _logger.error("Cannot open video output {}", target);
+        return;
+    }
+    const std::string header = std::format("YUV4MPEG2 W{} H{} F{}:1 Ip A1:1 C420jpeg\n", _width, _height, frameRate);
+
+    std::fwrite(header.data(), 1, header.size(), _output);
+    _worker = std::thread(&VideoWriter::work, this);
+    _logger.info("Recording {}x{} frames to {}", _width, _height, target);
+}
+
+void VideoWriter::submit(ImageJob frame) {
+    std::unique_lock lock(_mutex);
+
+    _spaceAvailable.wait(lock, [this] { return _queue.size() < QUEUE_CAPACITY; });
+    _queue.push_back(std::move(frame));
+    lock.unlock();
+    _frameAvailable.notify_one();
+}
+
+void VideoWriter::work() {
+    Profiler::getInstance().setThreadName("Video writer");
+    while (true) {
+        std::unique_lock lock(_mutex);
+
+        _frameAvailable.wait(lock, [this] { return _stopping || !_queue.empty(); });
+        if (_queue.empty())
+            return;
+        const ImageJob frame = std::move(_queue.front());
+
+        _queue.pop_front();
+        lock.unlock();
+        _spaceAvailable.notify_one();
+        encode(frame);
+    }
+}
+
+// BT.601 limited range, chroma is the average of each 2x2 block and GL rows are flipped on the way
+void VideoWriter::encode(const ImageJob &frame) {
+    PROFILE_ZONE("Encode video frame");
+    const size_t stride = static_cast<size_t>(frame.width) * 3;
+    unsigned char *lumaPlane = _planes.data();
+    unsigned char *uPlane = lumaPlane + static_cast<size_t>(_width) * _height;
+    unsigned char *vPlane = uPlane + static_cast<size_t>(_width / 2) * (_height / 2);
+
+    if (frame.width < _width || frame.height < _height)
+        return;
+    for (int y = 0; y < _height; y += 2) {
+        const unsigned char *top = frame.pixels.data() + (frame.height - 1 - y) * stride;
+        const unsigned char *bottom = top - stride;
+        unsigned char *lumaTop = lumaPlane + static_cast<size_t>(y) * _width;
+        unsigned char *lumaBottom = lumaTop + _width;
+        const size_t chromaRow = static_cast<size_t>(y / 2) * (_width / 2);
+
+        for (int x = 0; x < _width; x += 2) {
+            int red = 0;
+            int green = 0;
+            int blue = 0;
+
+            for (const auto &[row, luma]: {std::pair{top, lumaTop}, std::pair{bottom, lumaBottom}}) {
+                for (int column = x; column < x + 2; column++) {
+                    const int r = row[column * 3];
+                    const int g = row[column * 3 + 1];
+                    const int b = row[column * 3 + 2];
+
+                    luma[column] = static_cast<unsigned char>(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+                    red += r;
+                    green += g;
+                    blue += b;
+                }
+            }
+            red = (red + 2) / 4;
+            green = (green + 2) / 4;
+            blue = (blue + 2) / 4;
+            uPlane[chromaRow + x / 2] = static_cast<unsigned char>(((-38 * red - 74 * green + 112 * blue + 128) >> 8) + 128);
+            vPlane[chromaRow + x / 2] = static_cast<unsigned char>(((112 * red - 94 * green - 18 * blue + 128) >> 8) + 128);
+        }
+    }
+    std::fputs("FRAME\n", _output);
+    if (std::fwrite(_planes.data(), 1, _planes.size(), _output) != _planes.size())
+        _logger.error("Video frame {} could not be written", _frameCount);
+    _frameCount++;
+}
+
+VideoWriter::~VideoWriter() {
+    if (_output == nullptr)
+        return;
+    {
+        std::lock_guard lock(_mutex);
+
+        _stopping = true;
+    }
+    _frameAvailable.notify_one();
+    _worker.join();
+    if (_pipe)
+        pclose(_output);
+    else
+        std::fclose(_output);
+    _logger.info("Recorded {} frames", _frameCount);
+}
@@ -0,0 +1,93 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/async-readback.hpp"
+
+// STD Include //
+#include <utility>
+
+AsyncReadback::AsyncReadback(const unsigned slotCount, ReadbackFunction consumer)
+    : _consumer(std::move(consumer)), _slots(slotCount) {
+    for (Slot &slot: _slots)
+        glGenBuffers(1, &slot.buffer);
+}
+
+void AsyncReadback::request(const unsigned framebuffer, const int width, const int height, std::string filename) {
+    Slot &slot = _slots[_next];
+    const auto size = static_cast<size_t>(width) * height * 3;
+    GLint readFramebuffer = 0;
+
+    _next = (_next + 1) % _slots.size();
+    // Every buffer is in flight, the oldest one has to land before it is reused
+    if (slot.fence != nullptr) {
+        glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        collect(slot);
+    }
+
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (slot.capacity < size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_READ);
+        slot.capacity = size;
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(framebuffer == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, nullptr);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.job = {std::move(filename), width, height, {}};
+}
+
+void AsyncReadback::collect(Slot &slot) {
+    const auto size = static_cast<size_t>(slot.job.width) * slot.job.height * 3;
+
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+    if (const auto *pixels = static_cast<const unsigned char *>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(size), GL_MAP_READ_BIT))) {
+        slot.job.pixels.assign(pixels, pixels + size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        _consumer(std::move(slot.job));
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    slot.job = {};
+}
+
+// Fences signal in submission order, stopping at the first pending one keeps the consumer in request order
+void AsyncReadback::poll() {
+    for (unsigned index = 0; index < _slots.size(); index++) {
+        Slot &slot = _slots[(_next + index) % _slots.size()];
+
+        if (slot.fence == nullptr)
+            continue;
+        const GLenum status = glClientWaitSync(slot.fence, 0, 0);
+
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+            return;
+        collect(slot);
+    }
+}
+
+void AsyncReadback::finish() {
+    for (unsigned index = 0; index < _slots.size(); index++) {
+        Slot &slot = _slots[(_next + index) % _slots.size()];
+
+        if (slot.fence == nullptr)
+            continue;
+        glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        collect(slot);
+    }
+}
+
+AsyncReadback::~AsyncReadback() {
+    for (Slot &slot: _slots) {
+        if (slot.fence != nullptr)
+            glDeleteSync(slot.fence);
+        glDeleteBuffers(1, &slot.buffer);
+    }
+}
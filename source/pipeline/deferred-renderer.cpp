@@ -0,0 +1,232 @@
+#include <glad.hpp>
+
+// GLM Include //
+#include <glm/gtc/constants.hpp>
+
+// Header File Include //
+#include "pipeline/deferred-renderer.hpp"
+
+// STD Include //
+#include <cmath>
+#include <vector>
+
+constexpr unsigned SPHERE_RINGS = 8;
+constexpr unsigned SPHERE_SEGMENTS = 12;
+
+DeferredRenderer::DeferredRenderer(const int width, const int height)
+    : _width(width), _height(height),
+      _lightingShaders("shaders/fullscreenShader.vert", "shaders/deferredLightingShader.frag",
+                       SHADER_ILLUMINATION_MASK),
+      _volumeShader("shaders/deferredVolumeShader.vert", "shaders/deferredVolumeShader.frag"),
+      _compositeShader("shaders/fullscreenShader.vert", "shaders/deferredCompositeShader.frag") {
+    createGBuffer();
+    createAccumulationBuffer();
+    createSphere();
+    glGenVertexArrays(1, &_screenVAO);
+}
+
+void DeferredRenderer::createGBuffer() {
+    const auto createTexture = [this](unsigned &texture, const int internalFormat, const unsigned format,
+                                      const unsigned type) {
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, _width, _height, 0, format, type, nullptr);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    };
+    constexpr unsigned attachments[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2};
+
+    createTexture(_albedoTexture, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE);
+    createTexture(_normalTexture, GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT);
+    createTexture(_materialTexture, GL_R8, GL_RED, GL_UNSIGNED_BYTE);
+    createTexture(_depthTexture, GL_DEPTH_COMPONENT24, GL_DEPTH_COMPONENT, GL_FLOAT);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &_gBuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _gBuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _albedoTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, _normalTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT2, GL_TEXTURE_2D, _materialTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, _depthTexture, 0);
+    glDrawBuffers(3, attachments);
+    checkFramebuffer("G-buffer");
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void DeferredRenderer::createAccumulationBuffer() {
+    glGenTextures(1, &_accumulationTexture);
+    glBindTexture(GL_TEXTURE_2D, _accumulationTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, _width, _height, 0, GL_RGBA, GL_HALF_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    // Shares the G-buffer depth so light volumes can be depth tested against the scene
+    glGenFramebuffers(1, &_accumulationBuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _accumulationBuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _accumulationTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, _depthTexture, 0);
+    checkFramebuffer("Light accumulation");
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void DeferredRenderer::createSphere() {
+    std::vector<glm::vec3> vertices;
+    std::vector<unsigned> indices;
+
+    for (unsigned ring = 0; ring <= SPHERE_RINGS; ring++) {
+        const float phi = glm::pi<float>() * static_cast<float>(ring) / static_cast<float>(SPHERE_RINGS);
+
+        for (unsigned segment = 0; segment <= SPHERE_SEGMENTS; segment++) {
+            const float theta = 2.0f * glm::pi<float>() * static_cast<float>(segment) / static_cast<float>(SPHERE_SEGMENTS);
+
+            vertices.emplace_back(std::sin(phi) * std::cos(theta), std::cos(phi), std::sin(phi) * std::sin(theta));
+        }
+    }
+    for (unsigned ring = 0; ring < SPHERE_RINGS; ring++) {
+        for (unsigned segment = 0; segment < SPHERE_SEGMENTS; segment++) {
+            const unsigned current = ring * (SPHERE_SEGMENTS + 1) + segment;
+            const unsigned next = current + SPHERE_SEGMENTS + 1;
+
+            indices.insert(indices.end(), {current, current + 1, next, next, current + 1, next + 1});
+        }
+    }
+    _sphereIndexCount = static_cast<int>(indices.size());
+
+    glGenVertexArrays(1, &_sphereVAO);
+    glGenBuffers(1, &_sphereVBO);
+    glGenBuffers(1, &_sphereEBO);
+    glBindVertexArray(_sphereVAO);
+    glBindBuffer(GL_ARRAY_BUFFER, _sphereVBO);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<long>(vertices.size() * sizeof(glm::vec3)), vertices.data(),
+                 GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _sphereEBO);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<long>(indices.size() * sizeof(unsigned)), indices.data(),
+                 GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), nullptr);
+    glBindVertexArray(0);
+}
+
+void DeferredRenderer::checkFramebuffer(const char *name) const {
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        _logger.error("{} framebuffer is incomplete", name);
+}
+
+void DeferredRenderer::bindGBuffer(const Shader &shader) const {
+    glActiveTexture(GL_TEXTURE0 + GBUFFER_ALBEDO_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _albedoTexture);
+    glActiveTexture(GL_TEXTURE0 + GBUFFER_NORMAL_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _normalTexture);
+    glActiveTexture(GL_TEXTURE0 + GBUFFER_MATERIAL_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _materialTexture);
+    glActiveTexture(GL_TEXTURE0 + GBUFFER_DEPTH_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _depthTexture);
+    glActiveTexture(GL_TEXTURE0);
+
+    shader.setInt("gAlbedoMetallic", GBUFFER_ALBEDO_UNIT);
+    shader.setInt("gNormalRoughness", GBUFFER_NORMAL_UNIT);
+    shader.setInt("gMaterial", GBUFFER_MATERIAL_UNIT);
+    shader.setInt("gDepth", GBUFFER_DEPTH_UNIT);
+}
+
+void DeferredRenderer::beginGeometryPass() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, _gBuffer);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void DeferredRenderer::renderLighting(const LightClusters &lightClusters, const glm::mat4 &view,
+                                      const glm::mat4 &projection, const int illuminationModel) {
+    const Shader &lightingShader = _lightingShaders.get(makeIlluminationFeature(illuminationModel));
+    const glm::mat4 viewProjection = projection * view;
+    const glm::mat4 inverseViewProjection = inverse(viewProjection);
+    const auto cameraPosition = glm::vec3(inverse(view)[3]);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _accumulationBuffer);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_DEPTH_TEST);
+
+    // Ambient, directional, spot, shadows and reflections in a single full-screen pass
+    lightingShader.use();
+    bindGBuffer(lightingShader);
+    lightingShader.setMat4("inverseViewProjection", inverseViewProjection);
+    lightingShader.setVec3("cameraPosition", cameraPosition);
+    lightingShader.setFloat("reflectionStrength", 0.5f);
+    lightingShader.setInt("shadowMap", 30);
+    lightingShader.setInt("skybox", 31);
+    glBindVertexArray(_screenVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    // Point lights as additive volumes, back faces behind the scene only touch lit pixels
+    if (lightClusters.getLightCount() > 0) {
+        _volumeShader.use();
+        bindGBuffer(_volumeShader);
+        lightClusters.bindLights(_volumeShader);
+        _volumeShader.setMat4("viewProjection", viewProjection);
+        _volumeShader.setMat4("inverseViewProjection", inverseViewProjection);
+        _volumeShader.setVec3("cameraPosition", cameraPosition);
+        _volumeShader.setVec2("screenSize", static_cast<float>(_width), static_cast<float>(_height));
+        _volumeShader.setFloat("reflectionStrength", 0.5f);
+
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE);
+        glEnable(GL_DEPTH_TEST);
+        glDepthFunc(GL_GEQUAL);
+        glDepthMask(GL_FALSE);
+        glEnable(GL_CULL_FACE);
+        glCullFace(GL_FRONT);
+        glEnable(GL_DEPTH_CLAMP);
+
+        glBindVertexArray(_sphereVAO);
+        glDrawElementsInstanced(GL_TRIANGLES, _sphereIndexCount, GL_UNSIGNED_INT, nullptr,
+                                static_cast<int>(lightClusters.getLightCount()));
+
+        glDisable(GL_DEPTH_CLAMP);
+        glCullFace(GL_BACK);
+        glDisable(GL_CULL_FACE);
+        glDepthMask(GL_TRUE);
+        glDepthFunc(GL_LESS);
+        glDisable(GL_BLEND);
+    }
+    glBindVertexArray(0);
+    glEnable(GL_DEPTH_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void DeferredRenderer::composite() {
+    _compositeShader.use();
+    bindGBuffer(_compositeShader);
+    glActiveTexture(GL_TEXTURE0 + ACCUMULATION_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _accumulationTexture);
+    glActiveTexture(GL_TEXTURE0);
+    _compositeShader.setInt("accumulation", ACCUMULATION_UNIT);
+
+    // Writes the G-buffer depth back so the skybox and selection outlines still depth test
+    glDepthFunc(GL_ALWAYS);
+    glBindVertexArray(_screenVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    glDepthFunc(GL_LESS);
+}
+
+unsigned DeferredRenderer::reloadShaders(const std::vector<std::string> &files) {
+    return _lightingShaders.reloadIfChanged(files) + _volumeShader.reloadIfChanged(files) +
+           _compositeShader.reloadIfChanged(files);
+}
+
+DeferredRenderer::~DeferredRenderer() {
+    glDeleteVertexArrays(1, &_screenVAO);
+    glDeleteVertexArrays(1, &_sphereVAO);
+    glDeleteBuffers(1, &_sphereVBO);
+    glDeleteBuffers(1, &_sphereEBO);
+    glDeleteFramebuffers(1, &_accumulationBuffer);
+    glDeleteFramebuffers(1, &_gBuffer);
+    glDeleteTextures(1, &_accumulationTexture);
+    glDeleteTextures(1, &_albedoTexture);
+    glDeleteTextures(1, &_normalTexture);
+    glDeleteTextures(1, &_materialTexture);
+    glDeleteTextures(1, &_depthTexture);
+}
@@ -0,0 +1,61 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/frame-histogram.hpp"
+#include "pipeline/histogram.hpp"
+
+FrameHistogram::FrameHistogram() : _readback(3, [this](const ImageJob &job) { reduce(job); }) {
+    glGenTextures(1, &_texture);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    for (int level = 0; level <= READ_LEVEL; level++)
+        glTexImage2D(GL_TEXTURE_2D, level, GL_RGBA8, WIDTH >> level, HEIGHT >> level, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, READ_LEVEL);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &_blitFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _blitFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, 0);
+    glGenFramebuffers(1, &_readFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _readFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _texture, READ_LEVEL);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void FrameHistogram::capture(const unsigned framebuffer, const int width, const int height) {
+    _readback.poll();
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(framebuffer == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, _blitFramebuffer);
+    glBlitFramebuffer(0, 0, width, height, 0, 0, WIDTH, HEIGHT, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, _texture);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    _readback.request(_readFramebuffer, WIDTH >> READ_LEVEL, HEIGHT >> READ_LEVEL, "");
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+}
+
+// A few tens of thousands of pixels, the whole reduction fits in a fraction of the frame
+void FrameHistogram::reduce(const ImageJob &job) {
+    const int pixelCount = job.width * job.height;
+
+    _data.luminance = Histogram::computeGrayscale(job.pixels.data(), job.width, job.height, 3);
+    _data.red.fill(0);
+    _data.green.fill(0);
+    _data.blue.fill(0);
+    for (int index = 0; index < pixelCount; index++) {
+        _data.red[job.pixels[index * 3]]++;
+        _data.green[job.pixels[index * 3 + 1]]++;
+        _data.blue[job.pixels[index * 3 + 2]]++;
+    }
+    _data.pixelCount = pixelCount;
+}
+
+FrameHistogram::~FrameHistogram() {
+    glDeleteFramebuffers(1, &_readFramebuffer);
+    glDeleteFramebuffers(1, &_blitFramebuffer);
+    glDeleteTextures(1, &_texture);
+}
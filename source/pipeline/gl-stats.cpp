@@ -0,0 +1,183 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/gl-stats.hpp"
+
+#ifdef GL_STATS_ENABLED
+
+// STD Include //
+#include <type_traits>
+#include <utility>
+
+static GlCounters *counters = nullptr;
+
+// Forwards to the loaded function, Counter is bumped on top of the GL call count when given
+template<auto &Pointer, uint64_t GlCounters::*Counter, typename Function = std::remove_reference_t<decltype(Pointer)>>
+struct GlHook;
+
+template<auto &Pointer, uint64_t GlCounters::*Counter, typename Result, typename... Args>
+struct GlHook<Pointer, Counter, Result (APIENTRYP)(Args...)> {
+    static inline Result (APIENTRYP original)(Args...) = nullptr;
+
+    static Result APIENTRY call(Args... args) {
+        counters->glCalls++;
+        if constexpr (Counter != nullptr)
+            (counters->*Counter)++;
+        return original(args...);
+    }
+
+    static void install() {
+        original = Pointer;
+        Pointer = &call;
+    }
+};
+
+#define GL_STATS_HOOK(name) GlHook<glad_##name, nullptr>::install()
+#define GL_STATS_COUNT(name, counter) GlHook<glad_##name, &GlCounters::counter>::install()
+
+static PFNGLDRAWARRAYSPROC drawArrays;
+static PFNGLDRAWELEMENTSPROC drawElements;
+static PFNGLDRAWELEMENTSINSTANCEDPROC drawElementsInstanced;
+static PFNGLDRAWELEMENTSBASEVERTEXPROC drawElementsBaseVertex;
+static PFNGLBUFFERDATAPROC bufferData;
+static PFNGLBUFFERSUBDATAPROC bufferSubData;
+
+static void countDraw(const GLenum mode, const uint64_t vertices, const uint64_t instances = 1) {
+    counters->glCalls++;
+    counters->drawCalls++;
+    counters->vertices += vertices * instances;
+    if (mode == GL_TRIANGLES)
+        counters->triangles += vertices / 3 * instances;
+    else if ((mode == GL_TRIANGLE_STRIP || mode == GL_TRIANGLE_FAN) && vertices > 2)
+        counters->triangles += (vertices - 2) * instances;
+}
+
+static void APIENTRY countDrawArrays(const GLenum mode, const GLint first, const GLsizei count) {
+    countDraw(mode, count);
+    drawArrays(mode, first, count);
+}
+
+static void APIENTRY countDrawElements(const GLenum mode, const GLsizei count, const GLenum type,
+                                       const void *indices) {
+    countDraw(mode, count);
+    drawElements(mode, count, type, indices);
+}
+
+static void APIENTRY countDrawElementsInstanced(const GLenum mode, const GLsizei count, const GLenum type,
+                                                const void *indices, const GLsizei instances) {
+    countDraw(mode, count, instances);
+    drawElementsInstanced(mode, count, type, indices, instances);
+}
+
+static void APIENTRY countDrawElementsBaseVertex(const GLenum mode, const GLsizei count, const GLenum type,
+                                                 const void *indices, const GLint baseVertex) {
+    countDraw(mode, count);
+    drawElementsBaseVertex(mode, count, type, indices, baseVertex);
+}
+
+static void APIENTRY countBufferData(const GLenum target, const GLsizeiptr size, const void *data,
+                                     const GLenum usage) {
+    counters->glCalls++;
+    counters->bufferBytes += size;
+    bufferData(target, size, data, usage);
+}
+
+static void APIENTRY countBufferSubData(const GLenum target, const GLintptr offset, const GLsizeiptr size,
+                                        const void *data) {
+    counters->glCalls++;
+    counters->bufferBytes += size;
+    bufferSubData(target, offset, size, data);
+}
+
+void GlStats::install() {
+    if (_installed)
+        return;
+    _installed = true;
+    counters = &_frame[_pass];
+
+    drawArrays = std::exchange(glad_glDrawArrays, countDrawArrays);
+    drawElements = std::exchange(glad_glDrawElements, countDrawElements);
+    drawElementsInstanced = std::exchange(glad_glDrawElementsInstanced, countDrawElementsInstanced);
+    drawElementsBaseVertex = std::exchange(glad_glDrawElementsBaseVertex, countDrawElementsBaseVertex);
+    bufferData = std::exchange(glad_glBufferData, countBufferData);
+    bufferSubData = std::exchange(glad_glBufferSubData, countBufferSubData);
+
+    GL_STATS_COUNT(glUseProgram, programBinds);
+    GL_STATS_COUNT(glBindTexture, textureBinds);
+    GL_STATS_COUNT(glBindVertexArray, vertexArrayBinds);
+
+    GL_STATS_COUNT(glUniform1f, uniformUploads);
+    GL_STATS_COUNT(glUniform1i, uniformUploads);
+    GL_STATS_COUNT(glUniform2f, uniformUploads);
+    GL_STATS_COUNT(glUniform2fv, uniformUploads);
+    GL_STATS_COUNT(glUniform3f, uniformUploads);
+    GL_STATS_COUNT(glUniform3fv, uniformUploads);
+    GL_STATS_COUNT(glUniform4f, uniformUploads);
+    GL_STATS_COUNT(glUniform4fv, uniformUploads);
+    GL_STATS_COUNT(glUniformMatrix2fv, uniformUploads);
+    GL_STATS_COUNT(glUniformMatrix3fv, uniformUploads);
+    GL_STATS_COUNT(glUniformMatrix4fv, uniformUploads);
+    GL_STATS_COUNT(glProgramUniform1i, uniformUploads);
+    GL_STATS_COUNT(glProgramUniform1fv, uniformUploads);
+    GL_STATS_COUNT(glProgramUniform2fv, uniformUploads);
+    GL_STATS_COUNT(glProgramUniform3fv, uniformUploads);
+    GL_STATS_COUNT(glProgramUniform4fv, uniformUploads);
+    GL_STATS_COUNT(glProgramUniformMatrix3fv, uniformUploads);
+    GL_STATS_COUNT(glProgramUniformMatrix4fv, uniformUploads);
+
+    // State, resource and query calls issued by the renderer every frame
+    GL_STATS_HOOK(glActiveTexture);
+    GL_STATS_HOOK(glBeginQuery);
+    GL_STATS_HOOK(glBindBuffer);
+    GL_STATS_HOOK(glBindBufferBase);
+    GL_STATS_HOOK(glBindFramebuffer);
+    GL_STATS_HOOK(glBlendEquation);
+    GL_STATS_HOOK(glBlendFunc);
+    GL_STATS_HOOK(glClear);
+    GL_STATS_HOOK(glClearColor);
+    GL_STATS_HOOK(glColorMask);
+    GL_STATS_HOOK(glCullFace);
+    GL_STATS_HOOK(glDepthFunc);
+    GL_STATS_HOOK(glDepthMask);
+    GL_STATS_HOOK(glDisable);
+    GL_STATS_HOOK(glDrawBuffer);
+    GL_STATS_HOOK(glDrawBuffers);
+    GL_STATS_HOOK(glEnable);
+    GL_STATS_HOOK(glEndQuery);
+    GL_STATS_HOOK(glFrontFace);
+    GL_STATS_HOOK(glGetProgramiv);
+    GL_STATS_HOOK(glGetQueryObjectiv);
+    GL_STATS_HOOK(glGetQueryObjectui64v);
+    GL_STATS_HOOK(glGetUniformLocation);
+    GL_STATS_HOOK(glLineWidth);
+    GL_STATS_HOOK(glPolygonMode);
+    GL_STATS_HOOK(glQueryCounter);
+    GL_STATS_HOOK(glReadPixels);
+    GL_STATS_HOOK(glTexBuffer);
+    GL_STATS_HOOK(glTexImage2D);
+    GL_STATS_HOOK(glTexParameteri);
+    GL_STATS_HOOK(glViewport);
+}
+
+void GlStats::beginFrame() {
+    _lastFrame = _frame;
+    _frame = {};
+}
+
+GlPass GlStats::setPass(const GlPass pass) {
+    const GlPass previous = _pass;
+
+    _pass = pass;
+    counters = &_frame[pass];
+    return previous;
+}
+
+GlCounters GlStats::getCurrentFrameTotal() const {
+    GlCounters total;
+
+    for (const GlCounters &pass: _frame)
+        total.add(pass);
+    return total;
+}
+
+#endif
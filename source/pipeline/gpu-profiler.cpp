@@ -0,0 +1,101 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/gpu-profiler.hpp"
+#include "application/event-log.hpp"
+
+// STD Include //
+#include <algorithm>
+
+void GpuProfiler::collect(FrameQueries &frame) {
+    if (!frame.submitted || frame.count == 0)
+        return;
+    frame.submitted = false;
+    // Nested zones end out of order, every end query has to be checked before reading any result
+    for (unsigned zone = 0; zone < frame.count; zone++) {
+        int available = 0;
+
+        glGetQueryObjectiv(frame.queries[zone * 2 + 1], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            _dropped++;
+            return;
+        }
+    }
+
+    std::map<std::string, float> totals;
+    for (unsigned zone = 0; zone < frame.count; zone++) {
+        GLuint64 start = 0;
+        GLuint64 end = 0;
+
+        glGetQueryObjectui64v(frame.queries[zone * 2], GL_QUERY_RESULT, &start);
+        glGetQueryObjectui64v(frame.queries[zone * 2 + 1], GL_QUERY_RESULT, &end);
+        totals[frame.names[zone]] += static_cast<float>(end - std::min(start, end)) / 1000000.0f;
+    }
+    for (const auto &[name, milliseconds]: totals) {
+        std::deque<float> &history = _history[name];
+
+        history.push_back(milliseconds);
+        if (history.size() > HISTORY)
+            history.pop_front();
+        _last[name] = milliseconds;
+        EventLog::getInstance().record(GPU_PASS_EVENT, {milliseconds}, name, frame.frame);
+    }
+}
+
+void GpuProfiler::beginFrame() {
+    if (!_initialized) {
+        for (FrameQueries &frame: _frames)
+            glGenQueries(static_cast<int>(frame.queries.size()), frame.queries.data());
+        _initialized = true;
+    }
+    _frames[_current].submitted = _active;
+    _current = (_current + 1) % FRAME_LATENCY;
+    collect(_frames[_current]);
+    _frames[_current].count = 0;
+    _frames[_current].frame = EventLog::getInstance().getFrame();
+    // The event log wants pass times whether or not the profiler window is looking
+    _active = (Profiler::getInstance().isEnabled() && !Profiler::getInstance().isPaused()) ||
+              EventLog::getInstance().isOpen();
+}
+
+unsigned GpuProfiler::beginZone(const char *name) {
+    FrameQueries &frame = _frames[_current];
+
+    if (!_active || frame.count == MAX_ZONES)
+        return MAX_ZONES;
+    frame.names[frame.count] = name;
+    glQueryCounter(frame.queries[frame.count * 2], GL_TIMESTAMP);
+    return frame.count++;
+}
+
+void GpuProfiler::endZone(const unsigned zone) {
+    if (zone >= _frames[_current].count)
+        return;
+    glQueryCounter(_frames[_current].queries[zone * 2 + 1], GL_TIMESTAMP);
+}
+
+std::vector<std::pair<std::string, GpuZoneStats>> GpuProfiler::getStats() const {
+    std::vector<std::pair<std::string, GpuZoneStats>> stats;
+
+    for (const auto &[name, history]: _history) {
+        std::vector<float> sorted(history.begin(), history.end());
+        const auto percentile = [&sorted](const float ratio) {
+            return sorted[std::min(static_cast<size_t>(ratio * static_cast<float>(sorted.size())), sorted.size() - 1)];
+        };
+        GpuZoneStats zone;
+
+        if (sorted.empty())
+            continue;
+        std::ranges::sort(sorted);
+        for (const float value: sorted)
+            zone.average += value;
+        zone.average /= static_cast<float>(sorted.size());
+        zone.last = _last.at(name);
+        zone.p50 = percentile(0.50f);
+        zone.p95 = percentile(0.95f);
+        zone.p99 = percentile(0.99f);
+        zone.samples = sorted.size();
+        stats.emplace_back(name, zone);
+    }
+    return stats;
+}
@@ -0,0 +1,40 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/gpu-timer.hpp"
+
+GpuTimer::GpuTimer() {
+    glGenQueries(QUERY_COUNT, _queries.data());
+}
+
+void GpuTimer::collect() {
+    for (unsigned offset = 1; offset <= QUERY_COUNT; offset++) {
+        const unsigned index = (_current + offset) % QUERY_COUNT;
+        int available = 0;
+        GLuint64 elapsed = 0;
+
+        if (!_pending[index])
+            continue;
+        glGetQueryObjectiv(_queries[index], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available && index != _current)
+            continue;
+        glGetQueryObjectui64v(_queries[index], GL_QUERY_RESULT, &elapsed);
+        _milliseconds = static_cast<float>(elapsed) / 1000000.0f;
+        _pending[index] = false;
+    }
+}
+
+void GpuTimer::begin() {
+    collect();
+    glBeginQuery(GL_TIME_ELAPSED, _queries[_current]);
+}
+
+void GpuTimer::end() {
+    glEndQuery(GL_TIME_ELAPSED);
+    _pending[_current] = true;
+    _current = (_current + 1) % QUERY_COUNT;
+}
+
+GpuTimer::~GpuTimer() {
+    glDeleteQueries(QUERY_COUNT, _queries.data());
+}
@@ -1,12 +1,153 @@
 #include "pipeline/histogram.hpp"
+#include "pipeline/render-settings.hpp"
 
 #include <iostream>
 #include <stb_image.hpp>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <numeric>
+#include <thread>
 
-Histogram::Histogram(Window &window, const std::string &imagePath)
-    : TopLeftMenu("Greyscale Histogram"), _window(window), _imagePath(imagePath) {
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HISTOGRAM_X86
+#endif
+
+// Fixed point luminance, the weights add up to 256
+static constexpr unsigned RED_WEIGHT = 77;
+static constexpr unsigned GREEN_WEIGHT = 151;
+static constexpr unsigned BLUE_WEIGHT = 28;
+
+using Bins = std::array<uint32_t, 256>;
+
+static void computeLumaScalar(const unsigned char *pixels, const size_t count, const int channels,
+                              unsigned char *luma) {
+    for (size_t index = 0; index < count; index++) {
+        const unsigned char *pixel = pixels + index * channels;
+
+        luma[index] = channels < 3 ? pixel[0] : static_cast<unsigned char>(
+                          (RED_WEIGHT * pixel[0] + GREEN_WEIGHT * pixel[1] + BLUE_WEIGHT * pixel[2]) >> 8);
+    }
+}
+
+#ifdef HISTOGRAM_X86
+
+// Every 32 bit lane holds a pixel with red in its low byte, the weighted sum never exceeds 16 bits
+static __m128i computeLumaLanes(const __m128i pixels) {
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128i red = _mm_and_si128(pixels, mask);
+    const __m128i green = _mm_and_si128(_mm_srli_epi32(pixels, 8), mask);
+    const __m128i blue = _mm_and_si128(_mm_srli_epi32(pixels, 16), mask);
+    const __m128i sum = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(red, _mm_set1_epi32(RED_WEIGHT)),
+                                                    _mm_mullo_epi16(green, _mm_set1_epi32(GREEN_WEIGHT))),
+                                      _mm_mullo_epi16(blue, _mm_set1_epi32(BLUE_WEIGHT)));
+
+    return _mm_srli_epi32(sum, 8);
+}
+
+static __m128i loadPixels(const unsigned char *pixels, const int channels) {
+    if (channels == 4)
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels));
+    int lanes[4];
+
+    for (int lane = 0; lane < 4; lane++)
+        std::memcpy(&lanes[lane], pixels + lane * 3, sizeof(int));
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes));
+}
+
+// Returns the number of pixels done, the tail is left to the scalar loop
+static size_t computeLumaSse2(const unsigned char *pixels, const size_t count, const int channels,
+                              unsigned char *luma) {
+    size_t index = 0;
+
+    // RGB lanes load four bytes, the last pixel of the range would read past the end
+    for (; index + 17 <= count; index += 16) {
+        const unsigned char *block = pixels + index * channels;
+        const __m128i low = _mm_packs_epi32(computeLumaLanes(loadPixels(block, channels)),
+                                            computeLumaLanes(loadPixels(block + 4 * channels, channels)));
+        const __m128i high = _mm_packs_epi32(computeLumaLanes(loadPixels(block + 8 * channels, channels)),
+                                             computeLumaLanes(loadPixels(block + 12 * channels, channels)));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(luma + index), _mm_packus_epi16(low, high));
+    }
+    return index;
+}
+
+__attribute__((target("avx2")))
+static __m256i computeLumaLanes(const __m256i pixels) {
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    const __m256i red = _mm256_and_si256(pixels, mask);
+    const __m256i green = _mm256_and_si256(_mm256_srli_epi32(pixels, 8), mask);
+    const __m256i blue = _mm256_and_si256(_mm256_srli_epi32(pixels, 16), mask);
+    const __m256i sum = _mm256_add_epi16(_mm256_add_epi16(_mm256_mullo_epi16(red, _mm256_set1_epi32(RED_WEIGHT)),
+                                                          _mm256_mullo_epi16(green, _mm256_set1_epi32(GREEN_WEIGHT))),
+                                         _mm256_mullo_epi16(blue, _mm256_set1_epi32(BLUE_WEIGHT)));
+
+    return _mm256_srli_epi32(sum, 8);
+}
+
+// RGBA only, packing works per 128 bit half so the dwords are put back in order at the end
+__attribute__((target("avx2")))
+static size_t computeLumaAvx2(const unsigned char *pixels, const size_t count, unsigned char *luma) {
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    size_t index = 0;
+
+    for (; index + 32 <= count; index += 32) {
+        const auto *block = reinterpret_cast<const __m256i *>(pixels + index * 4);
+        const __m256i low = _mm256_packs_epi32(computeLumaLanes(_mm256_loadu_si256(block)),
+                                               computeLumaLanes(_mm256_loadu_si256(block + 1)));
+        const __m256i high = _mm256_packs_epi32(computeLumaLanes(_mm256_loadu_si256(block + 2)),
+                                                computeLumaLanes(_mm256_loadu_si256(block + 3)));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(luma + index),
+                            _mm256_permutevar8x32_epi32(_mm256_packus_epi16(low, high), order));
+    }
+    return index;
+}
+
+#endif
+
+static void computeLuma(const unsigned char *pixels, const size_t count, const int channels, unsigned char *luma) {
+    size_t done = 0;
+
+#ifdef HISTOGRAM_X86
+    static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+
+    if (channels == 4 && hasAvx2)
+        done = computeLumaAvx2(pixels, count, luma);
+    else if (channels >= 3)
+        done = computeLumaSse2(pixels, count, channels, luma);
+#endif
+    computeLumaScalar(pixels + done * channels, count - done, channels, luma + done);
+}
+
+// Four sub-histograms keep repeated values from serializing on the same counter
+static void countStrip(const unsigned char *pixels, const size_t count, const int channels, Bins &bins) {
+    constexpr size_t CHUNK = 4096;
+    unsigned char luma[CHUNK];
+    std::array<Bins, 4> partial{};
+
+    for (size_t start = 0; start < count; start += CHUNK) {
+        const size_t size = std::min(CHUNK, count - start);
+        size_t index = 0;
+
+        computeLuma(pixels + start * channels, size, channels, luma);
+        for (; index + 4 <= size; index += 4) {
+            partial[0][luma[index]]++;
+            partial[1][luma[index + 1]]++;
+            partial[2][luma[index + 2]]++;
+            partial[3][luma[index + 3]]++;
+        }
+        for (; index < size; index++)
+            partial[0][luma[index]]++;
+    }
+    for (size_t bin = 0; bin < bins.size(); bin++)
+        bins[bin] = partial[0][bin] + partial[1][bin] + partial[2][bin] + partial[3][bin];
+}
+
+Histogram::Histogram(Window &window, const FrameHistogram &frameHistogram, const std::string &imagePath)
+    : TopLeftMenu("Greyscale Histogram"), _window(window), _frameHistogram(frameHistogram), _imagePath(imagePath) {
     std::strncpy(_inputBuffer, _imagePath.c_str(), sizeof(_inputBuffer) - 1);
     _inputBuffer[sizeof(_inputBuffer) - 1] = '\0';
     compute();
@@ -24,23 +165,71 @@ void Histogram::compute() {
         return;
     }
 
-    std::fill(_grayscaleHistogram.begin(), _grayscaleHistogram.end(), 0);
+    _grayscaleHistogram = computeGrayscale(data, width, height, channels);
+    stbi_image_free(data);
+}
 
-    for (int i = 0; i < width * height; ++i) {
-        int r = data[i * channels];
-        int g = data[i * channels + 1];
-        int b = data[i * channels + 2];
+std::array<int, 256> Histogram::computeGrayscale(const unsigned char *data, const int width, const int height,
+                                                 const int channels) {
+    constexpr size_t PIXELS_PER_THREAD = 1 << 18;
+    std::array<int, 256> histogram{};
 
-        int gray = static_cast<int>(0.3 * r + 0.59 * g + 0.11 * b);
-        gray = std::clamp(gray, 0, 255);
+    if (data == nullptr || width <= 0 || height <= 0 || channels < 1 || channels > 4)
+        return histogram;
+    const size_t threadLimit = std::max(1u, std::thread::hardware_concurrency());
+    const size_t stripCount = std::clamp(static_cast<size_t>(width) * height / PIXELS_PER_THREAD, size_t{1},
+                                         std::min(threadLimit, static_cast<size_t>(height)));
+    const size_t rowsPerStrip = (height + stripCount - 1) / stripCount;
+    std::vector<Bins> strips(stripCount);
+    std::vector<std::thread> workers;
+    const auto count = [&](const size_t strip) {
+        const size_t firstRow = strip * rowsPerStrip;
+        const size_t lastRow = std::min(firstRow + rowsPerStrip, static_cast<size_t>(height));
 
-        _grayscaleHistogram[gray]++;
-    }
+        if (firstRow < lastRow)
+            countStrip(data + firstRow * width * channels, (lastRow - firstRow) * width, channels, strips[strip]);
+    };
 
-    stbi_image_free(data);
+    for (size_t strip = 1; strip < stripCount; strip++)
+        workers.emplace_back(count, strip);
+    count(0);
+    for (std::thread &worker: workers)
+        worker.join();
+    for (const Bins &bins: strips)
+        for (size_t bin = 0; bin < histogram.size(); bin++)
+            histogram[bin] += static_cast<int>(bins[bin]);
+    return histogram;
+}
+
+void Histogram::renderFrameHistogram() const {
+    const FrameHistogramData &data = _frameHistogram.getData();
+    const auto plot = [](const char *label, const std::array<int, 256> &bins, const float height) {
+        float values[256];
+
+        for (int i = 0; i < 256; ++i)
+            values[i] = static_cast<float>(bins[i]);
+        ImGui::PlotHistogram(label, values, 256, 0, nullptr, 0.0f,
+                             static_cast<float>(*std::max_element(bins.begin(), bins.end())), ImVec2(400, height));
+    };
+
+    if (data.pixelCount == 0) {
+        ImGui::Text("Waiting for the first frame...");
+        return;
+    }
+    plot("Luminance", data.luminance, 100);
+    plot("Red", data.red, 40);
+    plot("Green", data.green, 40);
+    plot("Blue", data.blue, 40);
+    ImGui::Text("%d sampled pixels", data.pixelCount);
 }
 
 void Histogram::renderMenu() {
+    ImGui::Checkbox("Rendered frame", &RenderSettings::instance().liveHistogram);
+    if (RenderSettings::instance().liveHistogram) {
+        renderFrameHistogram();
+        return;
+    }
+
     bool isHistogramEmpty = std::all_of(_grayscaleHistogram.begin(), _grayscaleHistogram.end(),
                                         [](int v) { return v == 0; });
 
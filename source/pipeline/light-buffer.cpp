@@ -0,0 +1,43 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/light-buffer.hpp"
+#include "pipeline/shader.hpp"
+
+LightBuffer::LightBuffer() {
+    glGenBuffers(1, &_ubo);
+    glBindBuffer(GL_UNIFORM_BUFFER, _ubo);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(LightBlock), nullptr, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    glBindBufferBase(GL_UNIFORM_BUFFER, LIGHTS_BLOCK_BINDING, _ubo);
+}
+
+void LightBuffer::sync(const LightRepository &lightRepository) {
+    if (_version == lightRepository.getVersion())
+        return;
+
+    const Light &directionalLight = lightRepository.getDirectionalLight();
+    const Light &spotLight = lightRepository.getSpotLight();
+    const LightBlock block = {
+        .lightSpaceMatrix = lightRepository.getDirectionalLightMatrix(),
+        .lightDir = directionalLight.direction,
+        .cutOff = glm::cos(glm::radians(3.0f)),
+        .lightColor = directionalLight.color,
+        .outerCutOff = glm::cos(glm::radians(5.0f)),
+        .ambientColor = lightRepository.getAmbientLight().color,
+        .padding0 = 0.0f,
+        .spotPos = spotLight.position,
+        .padding1 = 0.0f,
+        .spotDir = spotLight.direction,
+        .padding2 = 0.0f,
+    };
+
+    glBindBuffer(GL_UNIFORM_BUFFER, _ubo);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(LightBlock), &block);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+    _version = lightRepository.getVersion();
+}
+
+LightBuffer::~LightBuffer() {
+    glDeleteBuffers(1, &_ubo);
+}
@@ -0,0 +1,208 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/light-clusters.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+LightClusters::LightClusters() {
+    glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &_maxTexels);
+
+    glGenBuffers(1, &_gridBuffer);
+    glGenBuffers(1, &_indexBuffer);
+    glGenBuffers(1, &_lightBuffer);
+    glGenTextures(1, &_gridTexture);
+    glGenTextures(1, &_indexTexture);
+    glGenTextures(1, &_lightTexture);
+
+    _grid.assign(CLUSTER_COUNT * 2, 0);
+    _indices.assign(1, 0);
+    _lights.assign(2, glm::vec4(0.0f));
+    uploadLights();
+    uploadClusters();
+
+    glBindTexture(GL_TEXTURE_BUFFER, _gridTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RG32UI, _gridBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, _indexTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, _indexBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, _lightTexture);
+    glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, _lightBuffer);
+    glBindTexture(GL_TEXTURE_BUFFER, 0);
+}
+
+float LightClusters::getSliceDepth(const unsigned slice) const {
+    return _near * std::pow(_far / _near, static_cast<float>(slice) / static_cast<float>(CLUSTER_Z));
+}
+
+template<typename Visitor>
+void LightClusters::visitClusters(const glm::vec3 &center, const float radius, const glm::mat4 &projection,
+                                  Visitor &&visitor) const {
+    const float depth = -center.z;
+    const float minDepth = std::max(depth - radius, _near);
+    const float maxDepth = std::min(depth + radius, _far);
+    const float logRatio = std::log(_far / _near);
+
+    if (radius <= 0.0f || minDepth > maxDepth)
+        return;
+
+    const auto toSlice = [&](const float value) {
+        const float slice = std::log(value / _near) / logRatio * static_cast<float>(CLUSTER_Z);
+
+        return static_cast<unsigned>(std::clamp(slice, 0.0f, static_cast<float>(CLUSTER_Z - 1)));
+    };
+    const auto toTile = [](const float ndc, const unsigned count) {
+        const float tile = (ndc * 0.5f + 0.5f) * static_cast<float>(count);
+
+        return static_cast<unsigned>(std::clamp(tile, 0.0f, static_cast<float>(count - 1)));
+    };
+
+    for (unsigned slice = toSlice(minDepth); slice <= toSlice(maxDepth); slice++) {
+        const float sliceNear = std::max(getSliceDepth(slice), minDepth);
+        const float sliceFar = std::min(getSliceDepth(slice + 1), maxDepth);
+        const float offset = depth < sliceNear ? sliceNear - depth : depth > sliceFar ? depth - sliceFar : 0.0f;
+        const float extent = std::sqrt(std::max(radius * radius - offset * offset, 0.0f));
+        glm::vec2 ndcMin(std::numeric_limits<float>::max());
+        glm::vec2 ndcMax(std::numeric_limits<float>::lowest());
+
+        for (const float z: {sliceNear, sliceFar}) {
+            for (const float x: {-extent, extent}) {
+                for (const float y: {-extent, extent}) {
+                    const glm::vec4 clip = projection * glm::vec4(center.x + x, center.y + y, -z, 1.0f);
+                    const glm::vec2 ndc = glm::vec2(clip) / clip.w;
+
+                    ndcMin = min(ndcMin, ndc);
+                    ndcMax = max(ndcMax, ndc);
+                }
+            }
+        }
+        if (ndcMax.x < -1.0f || ndcMax.y < -1.0f || ndcMin.x > 1.0f || ndcMin.y > 1.0f)
+            continue;
+
+        for (unsigned y = toTile(ndcMin.y, CLUSTER_Y); y <= toTile(ndcMax.y, CLUSTER_Y); y++) {
+            for (unsigned x = toTile(ndcMin.x, CLUSTER_X); x <= toTile(ndcMax.x, CLUSTER_X); x++)
+                visitor(x + y * CLUSTER_X + slice * CLUSTER_X * CLUSTER_Y);
+        }
+    }
+}
+
+void LightClusters::syncLights(const LightRepository &lightRepository) {
+    const std::vector<Light> &pointLights = lightRepository.getPointLights();
+
+    if (_lightsVersion == lightRepository.getPointLightsVersion())
+        return;
+
+    _lightCount = std::min(pointLights.size(), static_cast<size_t>(_maxTexels / 2));
+    if (_lightCount < pointLights.size() && !_truncationReported) {
+        _logger.warn("Too many point lights: {} in the scene, only the first {} are shaded", pointLights.size(),
+                     _lightCount);
+        _truncationReported = true;
+    }
+    _lights.clear();
+    for (size_t index = 0; index < _lightCount; index++) {
+        const Light &light = pointLights[index];
+
+        _lights.emplace_back(light.position, getPointLightRadius(light));
+        _lights.emplace_back(light.color, 0.0f);
+    }
+    if (_lights.empty())
+        _lights.assign(2, glm::vec4(0.0f));
+    uploadLights();
+    _lightsVersion = lightRepository.getPointLightsVersion();
+}
+
+void LightClusters::update(const LightRepository &lightRepository, const glm::mat4 &view,
+                           const glm::mat4 &projection, const float near, const float far,
+                           const glm::vec2 &screenSize) {
+    size_t total = 0;
+
+    _near = near;
+    _far = far;
+    _screenSize = screenSize;
+    syncLights(lightRepository);
+
+    _cursor.assign(CLUSTER_COUNT, 0);
+    for (size_t index = 0; index < _lightCount; index++) {
+        const glm::vec4 &light = _lights[index * 2];
+
+        visitClusters(glm::vec3(view * glm::vec4(glm::vec3(light), 1.0f)), light.w, projection,
+                      [this](const unsigned cluster) { _cursor[cluster]++; });
+    }
+
+    for (unsigned cluster = 0; cluster < CLUSTER_COUNT; cluster++) {
+        _grid[cluster * 2] = static_cast<unsigned>(total);
+        _grid[cluster * 2 + 1] = 0;
+        total += _cursor[cluster];
+    }
+    if (total > static_cast<size_t>(_maxTexels) && !_overflowReported) {
+        _logger.warn("Light clusters overflow: {} indices for {} available", total, _maxTexels);
+        _overflowReported = true;
+    }
+    _indices.resize(std::max<size_t>(std::min(total, static_cast<size_t>(_maxTexels)), 1));
+
+    for (size_t index = 0; index < _lightCount; index++) {
+        const glm::vec4 &light = _lights[index * 2];
+
+        visitClusters(glm::vec3(view * glm::vec4(glm::vec3(light), 1.0f)), light.w, projection,
+                      [this, index](const unsigned cluster) {
+                          const unsigned position = _grid[cluster * 2] + _grid[cluster * 2 + 1];
+
+                          if (position >= _indices.size())
+                              return;
+                          _indices[position] = static_cast<unsigned>(index);
+                          _grid[cluster * 2 + 1]++;
+                      });
+    }
+    uploadClusters();
+}
+
+void LightClusters::uploadLights() const {
+    glBindBuffer(GL_TEXTURE_BUFFER, _lightBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, static_cast<long>(_lights.size() * sizeof(glm::vec4)), _lights.data(),
+                 GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void LightClusters::uploadClusters() const {
+    glBindBuffer(GL_TEXTURE_BUFFER, _gridBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, static_cast<long>(_grid.size() * sizeof(unsigned)), _grid.data(),
+                 GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, _indexBuffer);
+    glBufferData(GL_TEXTURE_BUFFER, static_cast<long>(_indices.size() * sizeof(unsigned)), _indices.data(),
+                 GL_STREAM_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+void LightClusters::bindLights(const Shader &shader) const {
+    glActiveTexture(GL_TEXTURE0 + CLUSTER_LIGHTS_UNIT);
+    glBindTexture(GL_TEXTURE_BUFFER, _lightTexture);
+
+    shader.setInt("pointLightData", CLUSTER_LIGHTS_UNIT);
+}
+
+void LightClusters::bind(const Shader &shader) const {
+    const float logRatio = std::log(_far / _near);
+
+    glActiveTexture(GL_TEXTURE0 + CLUSTER_GRID_UNIT);
+    glBindTexture(GL_TEXTURE_BUFFER, _gridTexture);
+    glActiveTexture(GL_TEXTURE0 + CLUSTER_INDICES_UNIT);
+    glBindTexture(GL_TEXTURE_BUFFER, _indexTexture);
+    bindLights(shader);
+
+    shader.setInt("clusterGrid", CLUSTER_GRID_UNIT);
+    shader.setInt("clusterLightIndices", CLUSTER_INDICES_UNIT);
+    shader.setVec2("clusterTileSize", _screenSize / glm::vec2(CLUSTER_X, CLUSTER_Y));
+    shader.setFloat("clusterDepthScale", static_cast<float>(CLUSTER_Z) / logRatio);
+    shader.setFloat("clusterDepthBias", -static_cast<float>(CLUSTER_Z) * std::log(_near) / logRatio);
+}
+
+LightClusters::~LightClusters() {
+    glDeleteTextures(1, &_gridTexture);
+    glDeleteTextures(1, &_indexTexture);
+    glDeleteTextures(1, &_lightTexture);
+    glDeleteBuffers(1, &_gridBuffer);
+    glDeleteBuffers(1, &_indexBuffer);
+    glDeleteBuffers(1, &_lightBuffer);
+}
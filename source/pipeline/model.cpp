@@ -32,15 +32,19 @@ void Model::render(const glm::mat4 &view, const glm::mat4 &projection) {
     glFrontFace(GL_CCW);
 
     Primitive::render(view, projection);
-    _shader.setBool("disableNormalMapping", false);
-
-    if (_textureEnabled->value())
-        _shader.setVec3("color", glm::vec3(-1));
     for (const auto &mesh: _meshes)
-        mesh.draw(_shader, _textureEnabled->value());
+        mesh.draw(*_shader, _textureEnabled->value());
     glDisable(GL_CULL_FACE);
 }
 
+unsigned Model::getShaderFeatures() const {
+    unsigned features = Primitive::getShaderFeatures() | SHADER_NORMAL_MAP;
+
+    if (_textureEnabled->value())
+        features |= SHADER_TEXTURED;
+    return features;
+}
+
 void Model::renderDepth(const Shader &shader) {
     Primitive::renderDepth(shader);
 
@@ -49,7 +53,7 @@ void Model::renderDepth(const Shader &shader) {
     glFrontFace(GL_CCW);
 
     for (const auto &mesh: _meshes)
-        mesh.draw(_shader, false);
+        mesh.draw(shader, false);
     glDisable(GL_CULL_FACE);
 }
 
@@ -2,10 +2,21 @@
 
 // Header File Include //
 #include "application/light-repository.hpp"
+#include "application/menu/scene-menu.hpp"
+#include "application/profiler.hpp"
+#include "pipeline/gl-stats.hpp"
+#include "pipeline/gpu-profiler.hpp"
 #include "pipeline/pipeline.hpp"
+#include "pipeline/render-settings.hpp"
+#include "pipeline/scene-store.hpp"
+#include "pipeline/shader-compiler.hpp"
 #include "pipeline/shader-factory.hpp"
 #include "pipeline/primitives/cube.hpp"
 
+// STD Include //
+#include <algorithm>
+#include <tuple>
+
 // GLFW Include //
 #include <GLFW/glfw3.h>
 
@@ -24,10 +35,21 @@ Pipeline::Pipeline() {
         return;
     }
     _logger.info("OpenGL version: {}", reinterpret_cast<const char *>(glGetString(GL_VERSION)));
+#ifdef GL_STATS_ENABLED
+    GlStats::getInstance().install();
+#endif
     glEnable(GL_DEPTH_TEST);
 
     _skybox = std::make_unique<Skybox>();
     _cubeMapTexture = Skybox::loadCubeMap(faces);
+    _lightClusters = std::make_unique<LightClusters>();
+    _lightBuffer = std::make_unique<LightBuffer>();
+    _deferredRenderer = std::make_unique<DeferredRenderer>(Window::WIDTH, Window::HEIGHT);
+    _depthPrePassTimer = std::make_unique<GpuTimer>();
+    _shadingPassTimer = std::make_unique<GpuTimer>();
+    _shaderWatcher = std::make_unique<ShaderWatcher>();
+    _frameHistogram = std::make_unique<FrameHistogram>();
+    _postProcessor = std::make_unique<PostProcessor>(Window::WIDTH, Window::HEIGHT);
 
     constexpr float borderColor[] = {1.0, 1.0, 1.0, 1.0};
 
@@ -52,42 +74,242 @@ Pipeline::Pipeline() {
     glBindFramebuffer(GL_FRAMEBUFFER, 0);
 }
 
-void Pipeline::render(const PrimitiveList &primitives, const glm::mat4 &view, const glm::mat4 &projection) const {
+// Every variant the scene needs is submitted up front so the driver compiles them all in flight together
+void Pipeline::prepareShaders(const PrimitiveList &primitives) const {
+    ShaderFactory &shaderFactory = ShaderFactory::getInstance();
+
+    for (const auto &primitive: primitives) {
+        shaderFactory.prepareTextureShader(primitive->getShaderFeatures());
+        shaderFactory.prepareGBufferShader(primitive->getShaderFeatures());
+    }
+}
+
+void Pipeline::setTargetFramebuffer(const unsigned framebuffer, const int width, const int height) {
+    _targetFramebuffer = framebuffer;
+    _targetWidth = width;
+    _targetHeight = height;
+}
+
+void Pipeline::bindTargetFramebuffer() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, _targetFramebuffer);
+    glDrawBuffer(_targetFramebuffer == 0 ? GL_BACK : GL_COLOR_ATTACHMENT0);
+}
+
+void Pipeline::reloadShaders() {
+    const std::vector<std::string> files = _shaderWatcher->poll();
+    unsigned reloaded;
+
+    if (files.empty())
+        return;
+    reloaded = ShaderFactory::getInstance().reloadShaders(files) + _skybox->reloadShaders(files) +
+               _deferredRenderer->reloadShaders(files) + _postProcessor->reloadShaders(files);
+    _logger.info("{} changed, recompiling {} programs", files.front(), reloaded);
+}
+
+void Pipeline::render(const glm::mat4 &view, const glm::mat4 &projection) {
     constexpr float radius = 10.0f;
     const double time = glfwGetTime();
     const auto directionalLightPosition = glm::vec3(radius * cos(time), 10.0f, radius * sin(time));
     const Shader &depthShader = ShaderFactory::getInstance().getDepthShader();
     LightRepository &lightRepository = LightRepository::getInstance();
-    Light &directionalLight = lightRepository.getDirectionalLight();
-    Light &spotLight = lightRepository.getSpotLight();
+    SceneStore &sceneStore = SceneStore::getInstance();
 
-    directionalLight.position = directionalLightPosition;
-    directionalLight.direction = normalize(-directionalLightPosition);
+    {
+        PROFILE_ZONE("Shader compile");
+        reloadShaders();
+        ShaderCompiler::getInstance().poll();
+    }
+    lightRepository.setDirectionalLight(directionalLightPosition, normalize(-directionalLightPosition));
+    lightRepository.setSpotLight(glm::vec3(inverse(view)[3]), glm::vec3(view[0][2], view[1][2], view[2][2]));
+    _lightBuffer->sync(lightRepository);
+    sceneStore.updateBounds();
 
-    spotLight.position = glm::vec3(inverse(view)[3]);
-    spotLight.direction = glm::vec3(view[0][2], view[1][2], view[2][2]);
+    {
+        PROFILE_ZONE("Shadow pass");
+        PROFILE_GPU_ZONE("Shadow pass");
+        GL_STATS_PASS(SHADOW_PASS);
+        const glm::mat4 lightSpaceMatrix = lightRepository.getDirectionalLightMatrix();
+        const std::span<Primitive *const> geometries = sceneStore.getGeometries();
+        const std::span<const uint8_t> flags = sceneStore.getFlags();
 
-    depthShader.use();
-    depthShader.setMat4("lightSpaceMatrix", lightRepository.getDirectionalLightMatrix());
+        depthShader.use();
+        depthShader.setMat4("lightSpaceMatrix", lightSpaceMatrix);
 
-    glViewport(0, 0, SHADOW_WIDTH, SHADOW_HEIGHT);
-    glBindFramebuffer(GL_FRAMEBUFFER, _depthFBO);
-    glClear(GL_DEPTH_BUFFER_BIT);
+        glViewport(0, 0, SHADOW_WIDTH, SHADOW_HEIGHT);
+        glBindFramebuffer(GL_FRAMEBUFFER, _depthFBO);
+        glClear(GL_DEPTH_BUFFER_BIT);
 
-    for (auto &primitive: primitives)
-        primitive->renderDepth(depthShader);
+        // Anything outside the light volume is clipped from the shadow map anyway
+        if (RenderSettings::instance().frustumCulling)
+            sceneStore.cull(lightSpaceMatrix, SCENE_SHADOW_VISIBLE);
+        else
+            sceneStore.markAll(SCENE_SHADOW_VISIBLE);
+        for (size_t index = 0; index < geometries.size(); index++)
+            if (flags[index] & SCENE_SHADOW_VISIBLE)
+                geometries[index]->renderDepth(depthShader);
+    }
 
-    glBindFramebuffer(GL_FRAMEBUFFER, 0);
-    glDrawBuffer(GL_BACK);
+    _postProcessor->beginScene();
 
     glViewport(0, 0, Window::WIDTH, Window::HEIGHT);
 
-    _skybox->render(_cubeMapTexture, glm::mat4(glm::mat3(view)), projection);
-
     glActiveTexture(GL_TEXTURE30);
     glBindTexture(GL_TEXTURE_2D, _shadow);
     glActiveTexture(GL_TEXTURE31);
     glBindTexture(GL_TEXTURE_CUBE_MAP, _cubeMapTexture);
-    for (const auto &primitive: primitives)
+    glActiveTexture(GL_TEXTURE0);
+
+    if (RenderSettings::instance().deferredShading)
+        renderDeferred(view, projection);
+    else
+        renderForward(view, projection);
+
+    {
+        const ToneMappingSettings &toneMapping = ToneMappingSettings::instance();
+
+        PROFILE_ZONE("Post");
+        PROFILE_GPU_ZONE("Post");
+        GL_STATS_PASS(POST_PASS);
+        if (toneMapping.enableToneMapping && toneMapping.autoExposure) {
+            _postProcessor->updateExposure(static_cast<float>(std::max(time - _lastTime, 0.0)));
+            glViewport(0, 0, Window::WIDTH, Window::HEIGHT);
+        }
+        bindTargetFramebuffer();
+        _postProcessor->resolve();
+    }
+    _lastTime = time;
+
+    if (RenderSettings::instance().liveHistogram) {
+        PROFILE_ZONE("Frame histogram");
+        PROFILE_GPU_ZONE("Frame histogram");
+        int width = _targetWidth;
+        int height = _targetHeight;
+
+        // A resized window has a back buffer smaller or larger than the rendered frame, only the overlap is read
+        if (_targetFramebuffer == 0)
+            glfwGetFramebufferSize(glfwGetCurrentContext(), &width, &height);
+        width = std::min(width, Window::WIDTH);
+        height = std::min(height, Window::HEIGHT);
+        if (width > 0 && height > 0)
+            _frameHistogram->capture(_targetFramebuffer, width, height);
+    }
+}
+
+void Pipeline::sortFrontToBack(const glm::mat4 &view, const glm::mat4 &projection) {
+    SceneStore &sceneStore = SceneStore::getInstance();
+    RenderStats &stats = RenderStats::instance();
+    const std::span<const AABB> boxes = sceneStore.getWorldBoxes();
+    const std::span<Primitive *const> geometries = sceneStore.getGeometries();
+    const std::span<const uint8_t> flags = sceneStore.getFlags();
+    // Only the depth row of the view matrix is needed for the sort key
+    const glm::vec4 depthRow(view[0][2], view[1][2], view[2][2], view[3][2]);
+
+    stats.scenePrimitives = static_cast<unsigned>(std::ranges::count_if(flags, [](const uint8_t entry) {
+        return (entry & SCENE_ACTIVE) != 0;
+    }));
+    if (RenderSettings::instance().frustumCulling)
+        stats.visiblePrimitives = static_cast<unsigned>(sceneStore.cull(projection * view, SCENE_VISIBLE));
+    else {
+        sceneStore.markAll(SCENE_VISIBLE);
+        stats.visiblePrimitives = stats.scenePrimitives;
+    }
+
+    _drawOrder.clear();
+    for (size_t index = 0; index < boxes.size(); index++) {
+        if (!(flags[index] & SCENE_VISIBLE))
+            continue;
+        const glm::vec3 center = (boxes[index].min + boxes[index].max) * 0.5f;
+
+        _drawOrder.emplace_back(-dot(depthRow, glm::vec4(center, 1.0f)), geometries[index]);
+    }
+    std::ranges::sort(_drawOrder, {}, &std::pair<float, Primitive *>::first);
+}
+
+void Pipeline::renderDepthPrePass(const glm::mat4 &view, const glm::mat4 &projection) {
+    const Shader &depthShader = ShaderFactory::getInstance().getDepthShader();
+
+    depthShader.use();
+    depthShader.setMat4("lightSpaceMatrix", projection * view);
+
+    glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+    for (const auto &[depth, primitive]: _drawOrder)
+        primitive->renderDepth(depthShader);
+    glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+}
+
+void Pipeline::renderForward(const glm::mat4 &view, const glm::mat4 &projection) {
+    ShaderFactory &shaderFactory = ShaderFactory::getInstance();
+    const LightRepository &lightRepository = LightRepository::getInstance();
+    const bool depthPrePass = RenderSettings::instance().depthPrePass;
+    RenderStats &stats = RenderStats::instance();
+
+    sortFrontToBack(view, projection);
+    if (depthPrePass) {
+        PROFILE_ZONE("Depth pre-pass");
+        PROFILE_GPU_ZONE("Depth pre-pass");
+        GL_STATS_PASS(DEPTH_PASS);
+        _depthPrePassTimer->begin();
+        renderDepthPrePass(view, projection);
+        _depthPrePassTimer->end();
+        stats.depthPrePassTime = _depthPrePassTimer->getMilliseconds();
+    }
+
+    _shadingPassTimer->begin();
+    {
+        PROFILE_ZONE("Skybox");
+        PROFILE_GPU_ZONE("Skybox");
+        GL_STATS_PASS(SKYBOX_PASS);
+        _skybox->render(_cubeMapTexture, glm::mat4(glm::mat3(view)), projection);
+    }
+
+    PROFILE_ZONE("Main pass");
+    PROFILE_GPU_ZONE("Main pass");
+    GL_STATS_PASS(MAIN_PASS);
+    _lightClusters->update(lightRepository, view, projection, Window::Z_NEAR, Window::Z_FAR,
+                           glm::vec2(Window::WIDTH, Window::HEIGHT));
+    // Variants are built before the per-frame bindings so none of them misses these uniforms
+    for (const auto &[depth, primitive]: _drawOrder)
+        std::ignore = shaderFactory.getTextureShader(primitive->getShaderFeatures());
+    shaderFactory.getTextureShaders().forEach([this](const Shader &textureShader) {
+        textureShader.use();
+        textureShader.setInt("shadowMap", 30);
+        textureShader.setInt("skybox", 31);
+        _lightClusters->bind(textureShader);
+    });
+
+    // Depth is already resolved, only the visible fragment of each pixel gets shaded
+    if (depthPrePass) {
+        glDepthFunc(GL_EQUAL);
+        glDepthMask(GL_FALSE);
+    }
+    for (const auto &[depth, primitive]: _drawOrder)
         primitive->render(view, projection);
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+    _shadingPassTimer->end();
+    stats.shadingPassTime = _shadingPassTimer->getMilliseconds();
+}
+
+void Pipeline::renderDeferred(const glm::mat4 &view, const glm::mat4 &projection) {
+    {
+        PROFILE_ZONE("Main pass");
+        PROFILE_GPU_ZONE("Main pass");
+        GL_STATS_PASS(MAIN_PASS);
+        _lightClusters->syncLights(LightRepository::getInstance());
+
+        sortFrontToBack(view, projection);
+        _deferredRenderer->beginGeometryPass();
+        for (const auto &[depth, primitive]: _drawOrder)
+            primitive->render(view, projection);
+
+        _deferredRenderer->renderLighting(*_lightClusters, view, projection,
+                                          RenderSettings::instance().illuminationModel);
+        _postProcessor->bindSceneFramebuffer();
+        _deferredRenderer->composite();
+    }
+
+    PROFILE_ZONE("Skybox");
+    PROFILE_GPU_ZONE("Skybox");
+    GL_STATS_PASS(SKYBOX_PASS);
+    _skybox->render(_cubeMapTexture, glm::mat4(glm::mat3(view)), projection);
 }
@@ -0,0 +1,188 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/post-processor.hpp"
+#include "application/menu/scene-menu.hpp"
+
+// STD Include //
+#include <algorithm>
+
+PostProcessor::PostProcessor(const int width, const int height)
+    : _width(width), _height(height),
+      _luminanceShader("shaders/fullscreenShader.vert", "shaders/luminanceShader.frag"),
+      _exposureShader("shaders/fullscreenShader.vert", "shaders/exposureShader.frag"),
+      _postShader("shaders/fullscreenShader.vert", "shaders/postShader.frag") {
+    createSceneFramebuffer();
+    createExposureTargets();
+    glGenVertexArrays(1, &_screenVAO);
+}
+
+void PostProcessor::createSceneFramebuffer() {
+    constexpr unsigned attachments[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+
+    glGenTextures(1, &_colorTexture);
+    glBindTexture(GL_TEXTURE_2D, _colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA16F, _width, _height, 0, GL_RGBA, GL_HALF_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glGenTextures(1, &_depthTexture);
+    glBindTexture(GL_TEXTURE_2D, _depthTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, _width, _height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glGenTextures(1, &_filterMaskTexture);
+    glBindTexture(GL_TEXTURE_2D, _filterMaskTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, _width, _height, 0, GL_RED, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &_sceneFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _sceneFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _colorTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, _filterMaskTexture, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, _depthTexture, 0);
+    glDrawBuffers(2, attachments);
+    checkFramebuffer("HDR scene");
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void PostProcessor::createExposureTargets() {
+    constexpr float initialExposure = 1.0f;
+
+    glGenTextures(1, &_luminanceTexture);
+    glBindTexture(GL_TEXTURE_2D, _luminanceTexture);
+    for (int level = 0; level < LUMINANCE_LEVELS; level++)
+        glTexImage2D(GL_TEXTURE_2D, level, GL_R16F, LUMINANCE_WIDTH >> level, std::max(LUMINANCE_HEIGHT >> level, 1),
+                     0, GL_RED, GL_HALF_FLOAT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, LUMINANCE_LEVELS - 1);
+
+    glGenFramebuffers(1, &_luminanceFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _luminanceFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _luminanceTexture, 0);
+    checkFramebuffer("Luminance");
+
+    glGenTextures(2, _exposureTextures);
+    glGenFramebuffers(2, _exposureFramebuffers);
+    for (int index = 0; index < 2; index++) {
+        glBindTexture(GL_TEXTURE_2D, _exposureTextures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_R32F, 1, 1, 0, GL_RED, GL_FLOAT, &initialExposure);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glBindFramebuffer(GL_FRAMEBUFFER, _exposureFramebuffers[index]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _exposureTextures[index], 0);
+        checkFramebuffer("Exposure");
+    }
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void PostProcessor::checkFramebuffer(const char *name) const {
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+        _logger.error("{} framebuffer is incomplete", name);
+}
+
+void PostProcessor::beginScene() const {
+    constexpr float noFilter[] = {0.0f, 0.0f, 0.0f, 0.0f};
+
+    bindSceneFramebuffer();
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glClearBufferfv(GL_COLOR, 1, noFilter);
+}
+
+void PostProcessor::bindSceneFramebuffer() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, _sceneFramebuffer);
+}
+
+void PostProcessor::updateExposure(const float deltaTime) {
+    const unsigned previous = _currentExposure;
+
+    _currentExposure = 1 - _currentExposure;
+    glDisable(GL_DEPTH_TEST);
+    glBindVertexArray(_screenVAO);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _luminanceFramebuffer);
+    glViewport(0, 0, LUMINANCE_WIDTH, LUMINANCE_HEIGHT);
+    _luminanceShader.use();
+    glActiveTexture(GL_TEXTURE0 + HDR_COLOR_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _colorTexture);
+    _luminanceShader.setInt("hdrColor", HDR_COLOR_UNIT);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    // The last level of the chain holds the average of every sample
+    glActiveTexture(GL_TEXTURE0 + LUMINANCE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _luminanceTexture);
+    glGenerateMipmap(GL_TEXTURE_2D);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _exposureFramebuffers[_currentExposure]);
+    glViewport(0, 0, 1, 1);
+    _exposureShader.use();
+    glActiveTexture(GL_TEXTURE0 + EXPOSURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _exposureTextures[previous]);
+    glActiveTexture(GL_TEXTURE0);
+    _exposureShader.setInt("logLuminance", LUMINANCE_UNIT);
+    _exposureShader.setInt("previousExposure", EXPOSURE_UNIT);
+    _exposureShader.setFloat("averageLevel", static_cast<float>(LUMINANCE_LEVELS - 1));
+    _exposureShader.setFloat("deltaTime", deltaTime);
+    _exposureShader.setFloat("adaptationSpeed", ToneMappingSettings::instance().adaptationSpeed);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+
+    glBindVertexArray(0);
+    glEnable(GL_DEPTH_TEST);
+}
+
+void PostProcessor::resolve() const {
+    const ToneMappingSettings &settings = ToneMappingSettings::instance();
+
+    _postShader.use();
+    glActiveTexture(GL_TEXTURE0 + HDR_COLOR_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _colorTexture);
+    glActiveTexture(GL_TEXTURE0 + HDR_DEPTH_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _depthTexture);
+    glActiveTexture(GL_TEXTURE0 + FILTER_MASK_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _filterMaskTexture);
+    glActiveTexture(GL_TEXTURE0 + EXPOSURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _exposureTextures[_currentExposure]);
+    glActiveTexture(GL_TEXTURE0);
+    _postShader.setInt("hdrColor", HDR_COLOR_UNIT);
+    _postShader.setInt("hdrDepth", HDR_DEPTH_UNIT);
+    _postShader.setInt("filterMask", FILTER_MASK_UNIT);
+    _postShader.setInt("adaptedExposure", EXPOSURE_UNIT);
+    _postShader.setBool("enableToneMapping", settings.enableToneMapping);
+    _postShader.setBool("autoExposure", settings.autoExposure);
+    _postShader.setFloat("toneMappingExposure", settings.toneMappingExposure);
+
+    glDepthFunc(GL_ALWAYS);
+    glBindVertexArray(_screenVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    glBindVertexArray(0);
+    glDepthFunc(GL_LESS);
+
+    // Nothing drawn into the scene target next frame may sample it
+    for (const int unit: {HDR_COLOR_UNIT, HDR_DEPTH_UNIT, EXPOSURE_UNIT, FILTER_MASK_UNIT}) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+    glActiveTexture(GL_TEXTURE0);
+}
+
+unsigned PostProcessor::reloadShaders(const std::vector<std::string> &files) {
+    return _luminanceShader.reloadIfChanged(files) + _exposureShader.reloadIfChanged(files) +
+           _postShader.reloadIfChanged(files);
+}
+
+PostProcessor::~PostProcessor() {
+    glDeleteVertexArrays(1, &_screenVAO);
+    glDeleteFramebuffers(2, _exposureFramebuffers);
+    glDeleteTextures(2, _exposureTextures);
+    glDeleteFramebuffers(1, &_luminanceFramebuffer);
+    glDeleteTextures(1, &_luminanceTexture);
+    glDeleteFramebuffers(1, &_sceneFramebuffer);
+    glDeleteTextures(1, &_colorTexture);
+    glDeleteTextures(1, &_depthTexture);
+    glDeleteTextures(1, &_filterMaskTexture);
+}
@@ -10,7 +10,7 @@ BezierSurface::BezierSurface()
         for (int j = 0; j < 4; ++j)
             _controlPoints[i][j] = glm::vec3(i - 1.5f, sin(i + j), j - 1.5f);
 
-    generateMesh();
+    updateMesh();
 
     glGenVertexArrays(1, &_VAO);
     glGenBuffers(1, &_VBO);
@@ -39,7 +39,7 @@ BezierSurface::~BezierSurface() {
     glDeleteBuffers(1, &_VBO);
 }
 
-glm::vec3 BezierSurface::bernstein(const float t, const glm::vec3 *points) const {
+glm::vec3 BezierSurface::bernstein(const float t, const glm::vec3 *points) {
     const float it = 1 - t;
 
     return points[0] * (it * it * it) +
@@ -48,18 +48,28 @@ glm::vec3 BezierSurface::bernstein(const float t, const glm::vec3 *points) const
            points[3] * (t * t * t);
 }
 
-glm::vec3 BezierSurface::evaluate(float u, float v) const {
+glm::vec3 BezierSurface::evaluate(const glm::vec3 (&controlPoints)[4][4], float u, float v) {
     glm::vec3 temp[4];
     for (int i = 0; i < 4; ++i)
-        temp[i] = bernstein(v, _controlPoints[i]);
+        temp[i] = bernstein(v, controlPoints[i]);
     return bernstein(u, temp);
 }
 
-void BezierSurface::generateMesh() {
-    _vertices.clear();
+void BezierSurface::updateMesh() {
+    AABB bounds{};
 
-    _minSize = glm::vec3(std::numeric_limits<float>::max());
-    _maxSize = glm::vec3(std::numeric_limits<float>::lowest());
+    _vertices = generateMesh(_controlPoints, resolutionU, resolutionV, bounds);
+    _minSize = bounds.min;
+    _maxSize = bounds.max;
+    markGeometryChanged();
+}
+
+std::vector<float> BezierSurface::generateMesh(const glm::vec3 (&controlPoints)[4][4], const int resolutionU,
+                                               const int resolutionV, AABB &bounds) {
+    std::vector<float> vertices;
+
+    bounds.min = glm::vec3(std::numeric_limits<float>::max());
+    bounds.max = glm::vec3(std::numeric_limits<float>::lowest());
 
     for (int i = 0; i < resolutionU; ++i) {
         float u = static_cast<float>(i) / (resolutionU - 1);
@@ -69,20 +79,20 @@ void BezierSurface::generateMesh() {
             float v = static_cast<float>(j) / (resolutionV - 1);
             float nextV = static_cast<float>(j + 1) / (resolutionV - 1);
 
-            glm::vec3 p1 = evaluate(u, v);
-            glm::vec3 p2 = evaluate(nextU, v);
-            glm::vec3 p3 = evaluate(u, nextV);
-            glm::vec3 p4 = evaluate(nextU, nextV);
+            glm::vec3 p1 = evaluate(controlPoints, u, v);
+            glm::vec3 p2 = evaluate(controlPoints, nextU, v);
+            glm::vec3 p3 = evaluate(controlPoints, u, nextV);
+            glm::vec3 p4 = evaluate(controlPoints, nextU, nextV);
 
             glm::vec3 n1 = normalize(cross(p2 - p1, p3 - p1));
             glm::vec3 n2 = normalize(cross(p4 - p2, p1 - p2));
             glm::vec3 tangent = normalize(p2 - p1);
 
             auto push = [&](const glm::vec3 &point, float uCoord, float vCoord, const glm::vec3 &normal) {
-                _minSize = min(_minSize, point);
-                _maxSize = max(_maxSize, point);
+                bounds.min = min(bounds.min, point);
+                bounds.max = max(bounds.max, point);
 
-                _vertices.insert(_vertices.end(), {
+                vertices.insert(vertices.end(), {
                                      point.x, point.y, point.z,
                                      uCoord, vCoord,
                                      normal.x, normal.y, normal.z,
@@ -99,6 +109,7 @@ void BezierSurface::generateMesh() {
             push(p3, u, nextV, n2);
         }
     }
+    return vertices;
 }
 
 void BezierSurface::render(const glm::mat4 &view, const glm::mat4 &projection) {
@@ -124,7 +135,7 @@ AABB BezierSurface::getLocalBox() const {
 void BezierSurface::setResolution(const int u, int v) {
     resolutionU = u;
     resolutionV = v;
-    generateMesh();
+    updateMesh();
 
     glBindBuffer(GL_ARRAY_BUFFER, _VBO);
     glBufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(float), _vertices.data(), GL_STATIC_DRAW);
@@ -17,36 +17,38 @@ CatmullRomCurve::~CatmullRomCurve() {
 
 void CatmullRomCurve::setControlPoints(const std::vector<glm::vec3> &points) {
     _controlPoints = points;
-    generateCurve();
+    updateCurve();
 }
 
 void CatmullRomCurve::setResolution(const int resolution) {
     _resolution = resolution;
-    generateCurve();
+    updateCurve();
 }
 
-void CatmullRomCurve::generateCurve() {
-    _vertices.clear();
+std::vector<float> CatmullRomCurve::generateCurve(const std::vector<glm::vec3> &controlPoints, const int resolution,
+                                                   std::vector<unsigned> &indices, AABB &bounds) {
+    std::vector<float> vertices;
 
-    _minSize = glm::vec3(std::numeric_limits<float>::max());
-    _maxSize = glm::vec3(std::numeric_limits<float>::lowest());
+    indices.clear();
+    bounds.min = glm::vec3(std::numeric_limits<float>::max());
+    bounds.max = glm::vec3(std::numeric_limits<float>::lowest());
 
-    if (_controlPoints.size() < 4)
-        return;
+    if (controlPoints.size() < 4)
+        return vertices;
 
     constexpr int circleSegments = 12;
 
     std::vector<glm::vec3> points;
     std::vector<glm::vec3> tangents;
 
-    for (size_t i = 0; i < _controlPoints.size() - 3; ++i) {
-        const glm::vec3 &P0 = _controlPoints[i];
-        const glm::vec3 &P1 = _controlPoints[i + 1];
-        const glm::vec3 &P2 = _controlPoints[i + 2];
-        const glm::vec3 &P3 = _controlPoints[i + 3];
+    for (size_t i = 0; i < controlPoints.size() - 3; ++i) {
+        const glm::vec3 &P0 = controlPoints[i];
+        const glm::vec3 &P1 = controlPoints[i + 1];
+        const glm::vec3 &P2 = controlPoints[i + 2];
+        const glm::vec3 &P3 = controlPoints[i + 3];
 
-        for (int j = 0; j <= _resolution; ++j) {
-            float t = static_cast<float>(j) / static_cast<float>(_resolution);
+        for (int j = 0; j <= resolution; ++j) {
+            float t = static_cast<float>(j) / static_cast<float>(resolution);
             float t2 = t * t;
             float t3 = t2 * t;
             glm::vec3 point = 0.5f * (2.0f * P1 + (-P0 + P2) * t +
@@ -75,9 +77,9 @@ void CatmullRomCurve::generateCurve() {
             glm::vec3 vertex = points[i] + radius * offset;
             glm::vec3 normalDir = normalize(offset);
 
-            _minSize = min(vertex, _minSize);
-            _maxSize = max(vertex, _maxSize);
-            _vertices.insert(_vertices.end(), {
+            bounds.min = min(vertex, bounds.min);
+            bounds.max = max(vertex, bounds.max);
+            vertices.insert(vertices.end(), {
                                  vertex.x, vertex.y, vertex.z,
                                  0.0f, 0.0f,
                                  normalDir.x, normalDir.y, normalDir.z,
@@ -86,7 +88,6 @@ void CatmullRomCurve::generateCurve() {
         }
     }
 
-    std::vector<unsigned int> indices;
     int ringSize = circleSegments + 1;
 
     for (size_t i = 0; i < points.size() - 1; ++i) {
@@ -109,7 +110,19 @@ void CatmullRomCurve::generateCurve() {
                            });
         }
     }
+    return vertices;
+}
 
+void CatmullRomCurve::updateCurve() {
+    std::vector<unsigned> indices;
+    AABB bounds{};
+
+    _vertices = generateCurve(_controlPoints, _resolution, indices, bounds);
+    _minSize = bounds.min;
+    _maxSize = bounds.max;
+    markGeometryChanged();
+    if (indices.empty())
+        return;
     if (_VBO == 0)
         glGenBuffers(1, &_VBO);
     if (_VAO == 0)
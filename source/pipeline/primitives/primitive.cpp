@@ -2,11 +2,11 @@
 
 #include <glm/gtc/quaternion.hpp>
 
-#include "application/light-repository.hpp"
 #include "exception/texture-exception.hpp"
 #include "pipeline/primitives/primitive.hpp"
 
-#include "application/menu/scene-menu.hpp"
+#include "pipeline/render-settings.hpp"
+#include "pipeline/shader-factory.hpp"
 #include "pipeline/texture-loader.hpp"
 
 void Primitive::initializePositionProperties() {
@@ -95,14 +95,14 @@ void Primitive::initializeTextureProperties() {
         // Value already managed by the property reference
     });
 
-    _colorR = std::make_shared<IntProperty>(COLOR, "R", _color.r, [this](const int value) {
-        _color.r = static_cast<float>(value) / 255.0f;
+    _colorR = std::make_shared<IntProperty>(COLOR, "R", 0, [this](const int value) {
+        getMaterial().color.r = static_cast<float>(value) / 255.0f;
     });
-    _colorG = std::make_shared<IntProperty>(COLOR, "G", _color.g, [this](const int value) {
-        _color.g = static_cast<float>(value) / 255.0f;
+    _colorG = std::make_shared<IntProperty>(COLOR, "G", 0, [this](const int value) {
+        getMaterial().color.g = static_cast<float>(value) / 255.0f;
     });
-    _colorB = std::make_shared<IntProperty>(COLOR, "B", _color.b, [this](const int value) {
-        _color.b = static_cast<float>(value) / 255.0f;
+    _colorB = std::make_shared<IntProperty>(COLOR, "B", 0, [this](const int value) {
+        getMaterial().color.b = static_cast<float>(value) / 255.0f;
     });
 
     _properties.emplace_back(std::make_shared<PropertyCategory>("Texture"));
@@ -114,14 +114,18 @@ void Primitive::initializeTextureProperties() {
 }
 
 void Primitive::initializeMaterialProperties() {
-    _roughnessProperty = std::make_shared<FloatProperty>(ROUGHNESS, "Roughness", _roughness, [this](const float value) {
-        _roughness = value;
-    });
-    _metallicProperty = std::make_shared<FloatProperty>(METALLIC, "Metallic", _metallic, [this](const float value) {
-        _metallic = value;
-    });
-    _filterProperty = std::make_shared<IntProperty>(FILTER, "Filter", _filterType, [this](const int value) {
-        _filterType = value;
+    const SceneMaterial &material = getMaterial();
+
+    _roughnessProperty = std::make_shared<FloatProperty>(ROUGHNESS, "Roughness", material.roughness,
+                                                         [this](const float value) {
+                                                             getMaterial().roughness = value;
+                                                         });
+    _metallicProperty = std::make_shared<FloatProperty>(METALLIC, "Metallic", material.metallic,
+                                                        [this](const float value) {
+                                                            getMaterial().metallic = value;
+                                                        });
+    _filterProperty = std::make_shared<IntProperty>(FILTER, "Filter", material.filterType, [this](const int value) {
+        getMaterial().filterType = value;
     });
 
     _properties.emplace_back(std::make_shared<PropertyCategory>("Material"));
@@ -131,12 +135,13 @@ void Primitive::initializeMaterialProperties() {
 }
 
 void Primitive::setTransformation(const glm::vec3 position, const glm::vec3 rotation, const glm::vec3 scale) {
-    _model = glm::translate(glm::mat4(1.0f), position)
-             * mat4_cast(glm::quat(radians(rotation)))
-             * glm::scale(glm::mat4(1.0f), scale);
+    setLocalModel(glm::translate(glm::mat4(1.0f), position)
+                  * mat4_cast(glm::quat(radians(rotation)))
+                  * glm::scale(glm::mat4(1.0f), scale));
 }
 
-Primitive::Primitive(Shader &shader, Shader &glowShader) : Selectable(glowShader), _shader(shader) {
+Primitive::Primitive(Shader &shader, Shader &glowShader)
+    : Selectable(glowShader), _handle(SceneStore::getInstance().create(this)), _shader(&shader) {
     initializePositionProperties();
     initializeRotationProperties();
     initializeScaleProperties();
@@ -146,70 +151,46 @@ Primitive::Primitive(Shader &shader, Shader &glowShader) : Selectable(glowShader
 
 void Primitive::render(const glm::mat4 &view, const glm::mat4 &projection) {
     const auto cameraPosition = glm::vec3(inverse(view)[3]);
-
-    LightRepository &lightRepository = LightRepository::getInstance();
-    const Light directionalLight = lightRepository.getDirectionalLight();
-    const Light ambientLight = lightRepository.getAmbientLight();
-    const Light spotLight = lightRepository.getSpotLight();
-    const std::vector<Light> pointLights = lightRepository.getPointLights();
-
-    _shader.use();
-    _shader.setMat4("projection", projection);
-    _shader.setMat4("view", view);
-    _shader.setMat4("model", _model);
-    _shader.setVec3("cameraPosition", cameraPosition);
-
-    _shader.setFloat("roughness", _roughness);
-    _shader.setFloat("metallic", _metallic);
-    _shader.setFloat("reflectionStrength", 0.5f);
-    _shader.setBool("disableNormalMapping", true);
-    _shader.setMat4("lightSpaceMatrix", lightRepository.getDirectionalLightMatrix());
-    _shader.setInt("shadowMap", 30);
-    _shader.setInt("skybox", 31);
-    _shader.setVec3("color", _color);
-    _shader.setInt("filterType", _filterType);
-
-    // Directional Light
-    _shader.setVec3("lightDir", directionalLight.direction);
-    _shader.setVec3("lightColor", directionalLight.color);
-    _shader.setVec3("ambientColor", ambientLight.color);
-
-    // Spot Light
-    _shader.setVec3("spotPos", spotLight.position);
-    _shader.setVec3("spotDir", spotLight.direction);
-    _shader.setFloat("cutOff", glm::cos(glm::radians(3.0f)));
-    _shader.setFloat("outerCutOff", glm::cos(glm::radians(5.0f)));
-
-    // Point Light
-    _shader.setInt("numPointLights", pointLights.size());
-    for (size_t i = 0; i < pointLights.size(); i++) {
-        const auto& light = pointLights[i];
-        std::string prefix = "pointLights[" + std::to_string(i) + "]";
-        _shader.setVec3(prefix + ".position", light.position);
-        _shader.setVec3(prefix + ".color", light.color);
-        _shader.setFloat(prefix + ".constant", 1.0f);
-        _shader.setFloat(prefix + ".linear", 0.09f);
-        _shader.setFloat(prefix + ".quadratic", 0.032f);
-    }
-
-    auto &[enableToneMapping, toneMappingExposure] = ToneMappingSettings::instance();
-    _shader.setBool("enableToneMapping", enableToneMapping);
-    _shader.setFloat("toneMappingExposure", toneMappingExposure);
+    const unsigned features = getShaderFeatures();
+    const SceneMaterial &material = getMaterial();
+
+    _shader = RenderSettings::instance().deferredShading
+                  ? &ShaderFactory::getInstance().getGBufferShader(features)
+                  : &ShaderFactory::getInstance().getTextureShader(features);
+    _shader->use();
+    _shader->setMat4("projection", projection);
+    _shader->setMat4("view", view);
+    _shader->setMat4("viewProjection", projection * view);
+    _shader->setMat4("model", getModel());
+    _shader->setVec3("cameraPosition", cameraPosition);
+
+    _shader->setFloat("roughness", material.roughness);
+    _shader->setFloat("metallic", material.metallic);
+    _shader->setFloat("reflectionStrength", 0.5f);
+    _shader->setVec3("color", material.color);
+    _shader->setInt("filterType", material.filterType);
 
     if (_texture != 0 && _textureEnabled->value()) {
         glActiveTexture(GL_TEXTURE1);
-        _shader.setInt("texture_diffuse1", 1);
-        _shader.setVec3("color", glm::vec3(-1));
+        _shader->setInt("texture_diffuse1", 1);
     }
     glBindTexture(GL_TEXTURE_2D, _texture);
 }
 
 void Primitive::renderDepth(const Shader &shader) {
-    shader.setMat4("model", _model);
+    shader.setMat4("model", getModel());
+}
+
+unsigned Primitive::getShaderFeatures() const {
+    unsigned features = makeIlluminationFeature(RenderSettings::instance().illuminationModel);
+
+    if (_texture != 0 && _textureEnabled->value())
+        features |= SHADER_TEXTURED;
+    return features;
 }
 
 void Primitive::translate(const glm::vec3 &translation) {
-    _model = glm::translate(_model, translation);
+    setLocalModel(glm::translate(getLocalModel(), translation));
     glm::vec3 position = getPosition();
 
     _positionX->updateValue(position[0]);
@@ -218,15 +199,35 @@ void Primitive::translate(const glm::vec3 &translation) {
 }
 
 void Primitive::rotate(const float degrees, const glm::vec3 &axis) {
-    _model = glm::rotate(_model, glm::radians(degrees), axis);
+    setLocalModel(glm::rotate(getLocalModel(), glm::radians(degrees), axis));
 }
 
 void Primitive::scale(const glm::vec3 &ratio) {
-    _model = glm::scale(_model, ratio);
+    setLocalModel(glm::scale(getLocalModel(), ratio));
 }
 
 void Primitive::scale(const float ratio) {
-    _model = glm::scale(_model, glm::vec3(ratio, ratio, ratio));
+    setLocalModel(glm::scale(getLocalModel(), glm::vec3(ratio, ratio, ratio)));
+}
+
+bool Primitive::setParent(const SceneHandle parent) {
+    if (!SceneStore::getInstance().setParent(_handle, parent))
+        return false;
+    // The local transform was rebased on the new parent, the menu shows it
+    const glm::vec3 position = getPosition();
+    const glm::vec3 rotation = getRotation();
+    const glm::vec3 scale = getScale();
+
+    _positionX->updateValue(position[0]);
+    _positionY->updateValue(position[1]);
+    _positionZ->updateValue(position[2]);
+    _rotationX->updateValue(rotation[0]);
+    _rotationY->updateValue(rotation[1]);
+    _rotationZ->updateValue(rotation[2]);
+    _scaleX->updateValue(scale[0]);
+    _scaleY->updateValue(scale[1]);
+    _scaleZ->updateValue(scale[2]);
+    return true;
 }
 
 void Primitive::loadTexture(const std::string &texturePath) {
@@ -236,40 +237,42 @@ void Primitive::loadTexture(const std::string &texturePath) {
 }
 
 glm::vec3 Primitive::getPosition() const {
-    return {_model[3]};
+    return {getLocalModel()[3]};
 }
 
 glm::vec3 Primitive::getRotation() const {
+    const glm::mat4 &model = getLocalModel();
     const glm::vec3 scale = getScale();
     glm::mat3 rotationMatrix;
 
-    rotationMatrix[0] = glm::vec3(_model[0]) / scale.x;
-    rotationMatrix[1] = glm::vec3(_model[1]) / scale.y;
-    rotationMatrix[2] = glm::vec3(_model[2]) / scale.z;
+    rotationMatrix[0] = glm::vec3(model[0]) / scale.x;
+    rotationMatrix[1] = glm::vec3(model[1]) / scale.y;
+    rotationMatrix[2] = glm::vec3(model[2]) / scale.z;
     return degrees(eulerAngles(quat_cast(rotationMatrix)));
 }
 
 glm::vec3 Primitive::getScale() const {
+    const glm::mat4 &model = getLocalModel();
     glm::vec3 scale;
 
-    scale.x = length(glm::vec3(_model[0]));
-    scale.y = length(glm::vec3(_model[1]));
-    scale.z = length(glm::vec3(_model[2]));
+    scale.x = length(glm::vec3(model[0]));
+    scale.y = length(glm::vec3(model[1]));
+    scale.z = length(glm::vec3(model[2]));
     return scale;
 }
 
 void Primitive::setRoughness(const float roughness) {
-    _roughness = roughness;
+    getMaterial().roughness = roughness;
     _roughnessProperty->updateValue(roughness);
 }
 
 void Primitive::setMetallic(const float metallic) {
-    _metallic = metallic;
+    getMaterial().metallic = metallic;
     _metallicProperty->updateValue(metallic);
 }
 
 void Primitive::setColor(const glm::vec3 color) {
-    _color = color;
+    getMaterial().color = color;
     _colorR->updateValue(static_cast<int>(255 * color.r));
     _colorG->updateValue(static_cast<int>(255 * color.g));
     _colorB->updateValue(static_cast<int>(255 * color.b));
@@ -277,5 +280,9 @@ void Primitive::setColor(const glm::vec3 color) {
 }
 
 void Primitive::applyFilter(const int filterType) {
-    _filterType = filterType;
+    getMaterial().filterType = filterType;
+}
+
+Primitive::~Primitive() {
+    SceneStore::getInstance().destroy(_handle);
 }
@@ -5,45 +5,45 @@
 #include "pipeline/shader-factory.hpp"
 
 void Sphere::updateTopology() {
-    generateMesh();
+    _vertices = generateMesh(_radius, _sectorCount, _stackCount);
 
     glBindBuffer(GL_ARRAY_BUFFER, _VBO);
     glBufferData(GL_ARRAY_BUFFER, _vertices.size() * sizeof(float), _vertices.data(), GL_STATIC_DRAW);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
-void Sphere::generateMesh() {
-    const float sectorStep = 2.0f * PI / static_cast<float>(_sectorCount);
-    const float stackStep = PI / static_cast<float>(_stackCount);
+std::vector<float> Sphere::generateMesh(const float radius, const unsigned sectorCount, const unsigned stackCount) {
+    const float sectorStep = 2.0f * PI / static_cast<float>(sectorCount);
+    const float stackStep = PI / static_cast<float>(stackCount);
+    std::vector<float> vertices;
 
-    _vertices.clear();
-    for (unsigned stackIndex = 0; stackIndex < _stackCount; ++stackIndex) {
+    for (unsigned stackIndex = 0; stackIndex < stackCount; ++stackIndex) {
         const float theta1 = static_cast<float>(stackIndex) * stackStep;
         const float theta2 = static_cast<float>(stackIndex + 1) * stackStep;
 
-        for (unsigned sectorIndex = 0; sectorIndex < _sectorCount; ++sectorIndex) {
+        for (unsigned sectorIndex = 0; sectorIndex < sectorCount; ++sectorIndex) {
             const float phi1 = static_cast<float>(sectorIndex) * sectorStep;
             const float phi2 = static_cast<float>(sectorIndex + 1) * sectorStep;
-            float x1 = _radius * std::sin(theta1) * std::cos(phi1);
-            float y1 = _radius * std::cos(theta1);
-            float z1 = _radius * std::sin(theta1) * std::sin(phi1);
-            float x2 = _radius * std::sin(theta2) * std::cos(phi1);
-            float y2 = _radius * std::cos(theta2);
-            float z2 = _radius * std::sin(theta2) * std::sin(phi1);
-            float x3 = _radius * std::sin(theta1) * std::cos(phi2);
-            float y3 = _radius * std::cos(theta1);
-            float z3 = _radius * std::sin(theta1) * std::sin(phi2);
-            float x4 = _radius * std::sin(theta2) * std::cos(phi2);
-            float y4 = _radius * std::cos(theta2);
-            float z4 = _radius * std::sin(theta2) * std::sin(phi2);
-            float u1 = static_cast<float>(sectorIndex) / static_cast<float>(_sectorCount);
-            float v1 = static_cast<float>(stackIndex) / static_cast<float>(_stackCount);
-            float u2 = static_cast<float>(sectorIndex) / static_cast<float>(_sectorCount);
-            float v2 = static_cast<float>(stackIndex + 1) / static_cast<float>(_stackCount);
-            float u3 = static_cast<float>(sectorIndex + 1) / static_cast<float>(_sectorCount);
-            float v3 = static_cast<float>(stackIndex) / static_cast<float>(_stackCount);
-            float u4 = static_cast<float>(sectorIndex + 1) / static_cast<float>(_sectorCount);
-            float v4 = static_cast<float>(stackIndex + 1) / static_cast<float>(_stackCount);
+            float x1 = radius * std::sin(theta1) * std::cos(phi1);
+            float y1 = radius * std::cos(theta1);
+            float z1 = radius * std::sin(theta1) * std::sin(phi1);
+            float x2 = radius * std::sin(theta2) * std::cos(phi1);
+            float y2 = radius * std::cos(theta2);
+            float z2 = radius * std::sin(theta2) * std::sin(phi1);
+            float x3 = radius * std::sin(theta1) * std::cos(phi2);
+            float y3 = radius * std::cos(theta1);
+            float z3 = radius * std::sin(theta1) * std::sin(phi2);
+            float x4 = radius * std::sin(theta2) * std::cos(phi2);
+            float y4 = radius * std::cos(theta2);
+            float z4 = radius * std::sin(theta2) * std::sin(phi2);
+            float u1 = static_cast<float>(sectorIndex) / static_cast<float>(sectorCount);
+            float v1 = static_cast<float>(stackIndex) / static_cast<float>(stackCount);
+            float u2 = static_cast<float>(sectorIndex) / static_cast<float>(sectorCount);
+            float v2 = static_cast<float>(stackIndex + 1) / static_cast<float>(stackCount);
+            float u3 = static_cast<float>(sectorIndex + 1) / static_cast<float>(sectorCount);
+            float v3 = static_cast<float>(stackIndex) / static_cast<float>(stackCount);
+            float u4 = static_cast<float>(sectorIndex + 1) / static_cast<float>(sectorCount);
+            float v4 = static_cast<float>(stackIndex + 1) / static_cast<float>(stackCount);
             glm::vec3 normal1 = normalize(glm::vec3(x1, y1, z1));
             glm::vec3 normal2 = normalize(glm::vec3(x2, y2, z2));
             glm::vec3 normal3 = normalize(glm::vec3(x3, y3, z3));
@@ -51,32 +51,33 @@ void Sphere::generateMesh() {
             glm::vec3 tangent1 = normalize(glm::vec3(x2 - x1, y2 - y1, z2 - z1));
             glm::vec3 tangent2 = normalize(glm::vec3(x3 - x1, y3 - y1, z3 - z1));
 
-            _vertices.insert(_vertices.end(), {
+            vertices.insert(vertices.end(), {
                                  x1, y1, z1, u1, v1, normal1.x, normal1.y, normal1.z, tangent1.x, tangent1.y, tangent1.z
                              });
-            _vertices.insert(_vertices.end(), {
+            vertices.insert(vertices.end(), {
                                  x2, y2, z2, u2, v2, normal2.x, normal2.y, normal2.z, tangent1.x, tangent1.y, tangent1.z
                              });
-            _vertices.insert(_vertices.end(), {
+            vertices.insert(vertices.end(), {
                                  x3, y3, z3, u3, v3, normal3.x, normal3.y, normal3.z, tangent2.x, tangent2.y, tangent2.z
                              });
 
-            _vertices.insert(_vertices.end(), {
+            vertices.insert(vertices.end(), {
                                  x2, y2, z2, u2, v2, normal2.x, normal2.y, normal2.z, tangent1.x, tangent1.y, tangent1.z
                              });
-            _vertices.insert(_vertices.end(), {
+            vertices.insert(vertices.end(), {
                                  x4, y4, z4, u4, v4, normal4.x, normal4.y, normal4.z, tangent2.x, tangent2.y, tangent2.z
                              });
-            _vertices.insert(_vertices.end(), {
+            vertices.insert(vertices.end(), {
                                  x3, y3, z3, u3, v3, normal3.x, normal3.y, normal3.z, tangent2.x, tangent2.y, tangent2.z
                              });
         }
     }
+    return vertices;
 }
 
 Sphere::Sphere(const float radius): Primitive(ShaderFactory::getInstance().getTextureShader(),
                                               ShaderFactory::getInstance().getGlowShader()), _radius(radius) {
-    generateMesh();
+    _vertices = generateMesh(_radius, _sectorCount, _stackCount);
 
     glGenVertexArrays(1, &_VAO);
     glGenBuffers(1, &_VBO);
@@ -0,0 +1,177 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/program-cache.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+constexpr uint32_t PROGRAM_CACHE_MAGIC = 0x42504c47; // "GLPB"
+
+static uint64_t hashFnv1a(const std::string &data, uint64_t hash = 14695981039346656037ull) {
+    for (const unsigned char character: data) {
+        hash ^= character;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+void ProgramCache::initialize() {
+    const auto getString = [](const unsigned name) {
+        const auto *value = reinterpret_cast<const char *>(glGetString(name));
+
+        return std::string(value ? value : "");
+    };
+    int formats = 0;
+    std::error_code error;
+
+    _initialized = true;
+    _driver = getString(GL_VENDOR) + '|' + getString(GL_RENDERER) + '|' + getString(GL_VERSION);
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0) {
+        _logger.info("Program binaries are not supported by this driver, shaders will always be compiled");
+        return;
+    }
+    std::filesystem::create_directories(_directory, error);
+    if (error) {
+        _logger.warn("Cannot create shader cache directory {}: {}", _directory.string(), error.message());
+        return;
+    }
+    _supported = true;
+    evict();
+}
+
+void ProgramCache::evict() const {
+    std::vector<std::filesystem::directory_entry> binaries;
+    uintmax_t size = 0;
+    unsigned removed = 0;
+    std::error_code error;
+
+    for (const auto &entry: std::filesystem::directory_iterator(_directory, error)) {
+        if (entry.path().extension() != ".bin" || !entry.is_regular_file(error))
+            continue;
+        size += entry.file_size(error);
+        binaries.push_back(entry);
+    }
+    if (size <= SIZE_LIMIT)
+        return;
+    std::ranges::sort(binaries, {}, [](const std::filesystem::directory_entry &entry) {
+        std::error_code timeError;
+
+        return entry.last_write_time(timeError);
+    });
+    for (const auto &entry: binaries) {
+        if (size <= SIZE_LIMIT)
+            break;
+        size -= entry.file_size(error);
+        removed += std::filesystem::remove(entry.path(), error);
+    }
+    _logger.info("Evicted {} least recently used program binaries from {}", removed, _directory.string());
+}
+
+std::string ProgramCache::makeKey(const std::string &vertexSource, const std::string &fragmentSource) {
+    uint64_t hash;
+    char key[17];
+
+    if (!_initialized)
+        initialize();
+    hash = hashFnv1a(vertexSource);
+    hash = hashFnv1a(std::string(1, '\0') + fragmentSource, hash);
+    hash = hashFnv1a(std::string(1, '\0') + _driver, hash);
+    std::snprintf(key, sizeof(key), "%016llx", static_cast<unsigned long long>(hash));
+    return key;
+}
+
+bool ProgramCache::load(const unsigned program, const std::string &key) {
+    const std::filesystem::path path = _directory / (key + ".bin");
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    const std::streamoff size = file.tellg();
+    uint32_t magic = 0;
+    uint32_t format = 0;
+    std::vector<char> binary;
+    int success = 0;
+    std::error_code error;
+
+    if (!_supported || !file.is_open())
+        return false;
+    file.seekg(0);
+    file.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char *>(&format), sizeof(format));
+    binary.resize(std::max<std::streamoff>(size - static_cast<std::streamoff>(sizeof(magic) + sizeof(format)), 0));
+    file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+    if (!file.good() || magic != PROGRAM_CACHE_MAGIC || binary.empty()) {
+        std::filesystem::remove(path);
+        return false;
+    }
+
+    glProgramBinary(program, format, binary.data(), static_cast<int>(binary.size()));
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        _logger.debug("Discarding stale program binary {}", path.string());
+        std::filesystem::remove(path);
+        return false;
+    }
+    // A hit counts as a use for the eviction order
+    std::filesystem::last_write_time(path, std::filesystem::file_time_type::clock::now(), error);
+    return true;
+}
+
+void ProgramCache::store(const unsigned program, const std::string &key) {
+    const std::filesystem::path path = _directory / (key + ".bin");
+    int success = 0;
+    int length = 0;
+    unsigned format = 0;
+    std::vector<char> binary;
+
+    if (!_supported)
+        return;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (!success || length <= 0)
+        return;
+    binary.resize(length);
+    glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    const uint32_t magic = PROGRAM_CACHE_MAGIC;
+    const uint32_t storedFormat = format;
+
+    file.write(reinterpret_cast<const char *>(&magic), sizeof(magic));
+    file.write(reinterpret_cast<const char *>(&storedFormat), sizeof(storedFormat));
+    file.write(binary.data(), static_cast<long>(binary.size()));
+    if (!file)
+        _logger.warn("Failed to write program binary {}", path.string());
+}
+
+void ProgramCache::remove(const std::string &key) const {
+    std::error_code error;
+
+    if (_supported)
+        std::filesystem::remove(_directory / (key + ".bin"), error);
+}
+
+void ProgramCache::recordLoad(const double milliseconds) {
+    _hits++;
+    _loadTime += milliseconds;
+}
+
+void ProgramCache::recordCompile(const double milliseconds) {
+    _misses++;
+    _compileTime += milliseconds;
+}
+
+void ProgramCache::report() const {
+    const auto average = [](const double total, const unsigned count) {
+        return count == 0 ? 0.0 : total / count;
+    };
+
+    _logger.info("Shader startup ({} start): {} programs in {:.1f} ms", _misses == 0 ? "warm" : "cold",
+                 _hits + _misses, _loadTime + _compileTime);
+    _logger.info("  cached:   {} in {:.1f} ms ({:.2f} ms/program)", _hits, _loadTime, average(_loadTime, _hits));
+    _logger.info("  compiled: {} in {:.1f} ms ({:.2f} ms/program)", _misses, _compileTime,
+                 average(_compileTime, _misses));
+}
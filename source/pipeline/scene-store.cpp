@@ -0,0 +1,240 @@
+// Header File Include //
+#include "pipeline/scene-store.hpp"
+#include "pipeline/primitives/primitive.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <thread>
+
+// The box of the transformed box, same result as transforming the eight corners for an affine model
+static AABB transformBox(const glm::mat4 &model, const AABB &box) {
+    const glm::vec3 center = glm::vec3(model * glm::vec4((box.min + box.max) * 0.5f, 1.0f));
+    const glm::mat3 absolute(abs(glm::vec3(model[0])), abs(glm::vec3(model[1])), abs(glm::vec3(model[2])));
+    const glm::vec3 extent = absolute * ((box.max - box.min) * 0.5f);
+
+    return {center - extent, center + extent};
+}
+
+SceneHandle SceneStore::create(Primitive *geometry) {
+    uint32_t slot;
+
+    if (_freeSlots.empty()) {
+        slot = static_cast<uint32_t>(_slots.size());
+        _slots.emplace_back();
+    } else {
+        slot = _freeSlots.back();
+        _freeSlots.pop_back();
+    }
+    _slots[slot].dense = static_cast<uint32_t>(_models.size());
+    _locals.emplace_back(1.0f);
+    _models.emplace_back(1.0f);
+    _parents.push_back(NO_PARENT);
+    _localBoxes.emplace_back();
+    _worldBoxes.emplace_back();
+    _materials.emplace_back();
+    _geometries.push_back(geometry);
+    _flags.push_back(geometry != nullptr ? SCENE_ACTIVE | SCENE_BOUNDS_DIRTY | SCENE_GEOMETRY_DIRTY : 0);
+    _slotOf.push_back(slot);
+    _orderDirty = true;
+    return {slot, _slots[slot].generation};
+}
+
+void SceneStore::destroy(const SceneHandle handle) {
+    if (!isValid(handle))
+        return;
+    const uint32_t index = indexOf(handle);
+    const auto removeAt = [index](auto &values) {
+        values[index] = values.back();
+        values.pop_back();
+    };
+
+    for (uint32_t child = 0; child < _parents.size(); child++) {
+        if (_parents[child] != handle.slot)
+            continue;
+        _locals[child] = _locals[index] * _locals[child];
+        _parents[child] = _parents[index];
+        _flags[child] |= SCENE_TRANSFORM_DIRTY;
+    }
+    _slots[_slotOf.back()].dense = index;
+    removeAt(_locals);
+    removeAt(_models);
+    removeAt(_parents);
+    removeAt(_localBoxes);
+    removeAt(_worldBoxes);
+    removeAt(_materials);
+    removeAt(_geometries);
+    removeAt(_flags);
+    removeAt(_slotOf);
+    _slots[handle.slot].generation++;
+    _freeSlots.push_back(handle.slot);
+    _orderDirty = true;
+    _transformsDirty = true;
+}
+
+void SceneStore::setLocal(const SceneHandle handle, const glm::mat4 &local) {
+    const uint32_t index = indexOf(handle);
+
+    _locals[index] = local;
+    _flags[index] |= SCENE_TRANSFORM_DIRTY;
+    _transformsDirty = true;
+}
+
+bool SceneStore::setParent(const SceneHandle child, const SceneHandle parent) {
+    const uint32_t parentSlot = isValid(parent) ? parent.slot : NO_PARENT;
+
+    if (!isValid(child))
+        return false;
+    for (uint32_t slot = parentSlot; slot != NO_PARENT; slot = _parents[_slots[slot].dense])
+        if (slot == child.slot)
+            return false;
+    const uint32_t index = indexOf(child);
+
+    if (_parents[index] == parentSlot)
+        return true;
+    // Both world transforms have to be current for the local one to be rebased
+    updateTransforms();
+    _locals[index] = parentSlot == NO_PARENT ? _models[index]
+                                             : inverse(_models[_slots[parentSlot].dense]) * _models[index];
+    _parents[index] = parentSlot;
+    _flags[index] |= SCENE_TRANSFORM_DIRTY;
+    _orderDirty = true;
+    _transformsDirty = true;
+    return true;
+}
+
+void SceneStore::setFlag(const SceneHandle handle, const SceneFlag flag, const bool enabled) {
+    uint8_t &flags = _flags[indexOf(handle)];
+
+    flags = enabled ? flags | flag : flags & ~flag;
+}
+
+// Breadth first walk from the roots over a child list grouped by parent
+void SceneStore::rebuildOrder() {
+    const auto count = static_cast<uint32_t>(_parents.size());
+    std::vector<uint32_t> childStarts(count + 1, 0);
+    std::vector<uint32_t> children(count);
+
+    for (const uint32_t parent: _parents)
+        if (parent != NO_PARENT)
+            childStarts[_slots[parent].dense + 1]++;
+    for (uint32_t index = 0; index < count; index++)
+        childStarts[index + 1] += childStarts[index];
+    std::vector<uint32_t> cursors(childStarts.begin(), childStarts.end() - 1);
+
+    for (uint32_t index = 0; index < count; index++)
+        if (_parents[index] != NO_PARENT)
+            children[cursors[_slots[_parents[index]].dense]++] = index;
+    _order.clear();
+    _levelStarts.assign(1, 0);
+    for (uint32_t index = 0; index < count; index++)
+        if (_parents[index] == NO_PARENT)
+            _order.push_back(index);
+    for (size_t levelBegin = 0; levelBegin < _order.size();) {
+        const size_t levelEnd = _order.size();
+
+        for (size_t position = levelBegin; position < levelEnd; position++)
+            for (uint32_t child = childStarts[_order[position]]; child < childStarts[_order[position] + 1]; child++)
+                _order.push_back(children[child]);
+        _levelStarts.push_back(levelEnd);
+        levelBegin = levelEnd;
+    }
+    _orderDirty = false;
+}
+
+// Only reads the flags and world transforms of the level above, which is finished by then
+void SceneStore::updateTransforms(const size_t begin, const size_t end) {
+    for (size_t position = begin; position < end; position++) {
+        const uint32_t index = _order[position];
+        const uint32_t parent = _parents[index] == NO_PARENT ? NO_PARENT : _slots[_parents[index]].dense;
+        const bool parentChanged = parent != NO_PARENT && _flags[parent] & SCENE_WORLD_CHANGED;
+        uint8_t &flags = _flags[index];
+
+        flags &= ~SCENE_WORLD_CHANGED;
+        if (!(flags & SCENE_TRANSFORM_DIRTY) && !parentChanged)
+            continue;
+        _models[index] = parent == NO_PARENT ? _locals[index] : _models[parent] * _locals[index];
+        flags = (flags & ~SCENE_TRANSFORM_DIRTY) | SCENE_WORLD_CHANGED | SCENE_BOUNDS_DIRTY;
+    }
+}
+
+void SceneStore::updateTransforms() {
+    constexpr size_t ENTRIES_PER_THREAD = 1 << 14;
+
+    if (_orderDirty)
+        rebuildOrder();
+    if (!_transformsDirty)
+        return;
+    const size_t threadLimit = std::max(1u, std::thread::hardware_concurrency());
+
+    for (size_t level = 0; level + 1 < _levelStarts.size(); level++) {
+        const size_t begin = _levelStarts[level];
+        const size_t end = _levelStarts[level + 1];
+        const size_t chunkCount = std::clamp((end - begin) / ENTRIES_PER_THREAD, size_t{1}, threadLimit);
+        const size_t chunkSize = (end - begin + chunkCount - 1) / chunkCount;
+        std::vector<std::thread> workers;
+        const auto update = [&](const size_t chunk) {
+            updateTransforms(begin + chunk * chunkSize, std::min(begin + (chunk + 1) * chunkSize, end));
+        };
+
+        for (size_t chunk = 1; chunk < chunkCount; chunk++)
+            workers.emplace_back(update, chunk);
+        update(0);
+        for (std::thread &worker: workers)
+            worker.join();
+    }
+    _transformsDirty = false;
+}
+
+void SceneStore::updateBounds(const uint32_t index) {
+    if (_flags[index] & SCENE_GEOMETRY_DIRTY && _geometries[index] != nullptr)
+        _localBoxes[index] = _geometries[index]->getLocalBox();
+    _worldBoxes[index] = transformBox(_models[index], _localBoxes[index]);
+    _flags[index] &= ~(SCENE_BOUNDS_DIRTY | SCENE_GEOMETRY_DIRTY);
+}
+
+AABB SceneStore::getWorldBox(const SceneHandle handle) {
+    const uint32_t index = indexOf(handle);
+
+    updateTransforms();
+    if (_flags[index] & (SCENE_BOUNDS_DIRTY | SCENE_GEOMETRY_DIRTY))
+        updateBounds(index);
+    return _worldBoxes[index];
+}
+
+void SceneStore::updateBounds() {
+    updateTransforms();
+    for (uint32_t index = 0; index < _flags.size(); index++)
+        if (_flags[index] & (SCENE_BOUNDS_DIRTY | SCENE_GEOMETRY_DIRTY))
+            updateBounds(index);
+}
+
+size_t SceneStore::cull(const glm::mat4 &viewProjection, const SceneFlag flag) {
+    const glm::mat4 rows = transpose(viewProjection);
+    // Planes point inwards, a box is outside when its corner furthest along a normal is still behind the plane
+    const glm::vec4 planes[6] = {
+        rows[3] + rows[0], rows[3] - rows[0], rows[3] + rows[1], rows[3] - rows[1], rows[3] + rows[2],
+        rows[3] - rows[2]
+    };
+    size_t count = 0;
+
+    for (size_t index = 0; index < _worldBoxes.size(); index++) {
+        const auto &[min, max] = _worldBoxes[index];
+        bool inside = _flags[index] & SCENE_ACTIVE;
+
+        for (const glm::vec4 &plane: planes) {
+            if (!inside)
+                break;
+            const glm::vec3 normal(plane);
+
+            inside = dot(normal, mix(min, max, greaterThanEqual(normal, glm::vec3(0.0f)))) + plane.w >= 0.0f;
+        }
+        _flags[index] = inside ? _flags[index] | flag : _flags[index] & ~flag;
+        count += inside;
+    }
+    return count;
+}
+
+void SceneStore::markAll(const SceneFlag flag) {
+    for (uint8_t &flags: _flags)
+        flags = flags & SCENE_ACTIVE ? flags | flag : flags & ~flag;
+}
@@ -13,24 +13,29 @@ float Intersection::calculateDistance(glm::vec3 origin, glm::vec3 direction, AAB
     return tNear <= tFar && tFar > 0.0f ? tNear : -1;
 }
 
-PrimitivePtr Intersection::findNearestPrimitive(const PrimitiveList &primitives, const glm::vec3 origin,
-                                                const glm::vec3 direction) {
-    PrimitivePtr nearestPrimitive = nullptr;
+PrimitivePtr Intersection::findNearestPrimitive(const glm::vec3 origin, const glm::vec3 direction) {
+    SceneStore &sceneStore = SceneStore::getInstance();
+    Primitive *nearestPrimitive = nullptr;
     float nearestDistance = std::numeric_limits<float>::max();
 
-    for (const auto &primitive: primitives) {
-        const float distance = calculateDistance(origin, direction, primitive->getCollisionBox());
+    sceneStore.updateBounds();
+    const std::span<const AABB> boxes = sceneStore.getWorldBoxes();
+    const std::span<const uint8_t> flags = sceneStore.getFlags();
+
+    for (size_t index = 0; index < boxes.size(); index++) {
+        if (!(flags[index] & SCENE_ACTIVE))
+            continue;
+        const float distance = calculateDistance(origin, direction, boxes[index]);
 
         if (distance == -1 || distance > nearestDistance)
             continue;
-        nearestPrimitive = primitive;
+        nearestPrimitive = sceneStore.getGeometries()[index];
         nearestDistance = distance;
     }
-    return nearestPrimitive;
+    return nearestPrimitive == nullptr ? nullptr : nearestPrimitive->weak_from_this().lock();
 }
 
-PrimitivePtr Intersection::findNearestPrimitive(const PrimitiveList &primitives, const Window &window,
-                                                const Coordinates &mouse) {
+PrimitivePtr Intersection::findNearestPrimitive(const Window &window, const Coordinates &mouse) {
     const float x = (2.0f * static_cast<float>(mouse.first)) / static_cast<float>(window.getWidth()) - 1.0f;
     const float y = 1.0f - (2.0f * static_cast<float>(mouse.second)) / static_cast<float>(window.getHeight());
 
@@ -42,7 +47,7 @@ PrimitivePtr Intersection::findNearestPrimitive(const PrimitiveList &primitives,
         auto originWorld = glm::vec3(inverse(window.getView()) * originEye);
         auto rayWorld = glm::vec3(inverse(window.getView()) * glm::vec4(0.0f, 0.0f, -1.0f, 0.0f));
 
-        return findNearestPrimitive(primitives, originWorld, rayWorld);
+        return findNearestPrimitive(originWorld, rayWorld);
     }
 
     const glm::vec3 rayNds(x, y, -1.0);
@@ -50,6 +55,6 @@ PrimitivePtr Intersection::findNearestPrimitive(const PrimitiveList &primitives,
     glm::vec4 rayEye = inverse(window.getProjection()) * rayClip;
 
     rayEye = glm::vec4(rayEye.x, rayEye.y, -1.0f, 0.0f);
-    return findNearestPrimitive(primitives, window.getCameraPosition(),
+    return findNearestPrimitive(window.getCameraPosition(),
                                 normalize(glm::vec3(inverse(window.getView()) * rayEye)));
 }
@@ -3,29 +3,6 @@
 
 #include "pipeline/selection/selectable.hpp"
 
-std::vector<glm::vec3> Selectable::transformLocalBox() const {
-    const auto &[min, max] = getLocalBox();
-    const glm::vec3 corners[8] = {
-        glm::vec3(min.x, min.y, min.z),
-        glm::vec3(min.x, min.y, max.z),
-        glm::vec3(min.x, max.y, min.z),
-        glm::vec3(min.x, max.y, max.z),
-        glm::vec3(max.x, min.y, min.z),
-        glm::vec3(max.x, min.y, max.z),
-        glm::vec3(max.x, max.y, min.z),
-        glm::vec3(max.x, max.y, max.z)
-    };
-    std::vector<glm::vec3> points;
-
-    for (unsigned index = 0; index < 8; index++) {
-        glm::vec4 position = _model * glm::vec4(corners[index], 1.0f);
-
-        points.push_back(glm::vec3(position));
-    }
-
-    return points;
-}
-
 Selectable::Selectable(Shader &shader) : _shader(shader) {
     const auto indicesLength = static_cast<long>(_indices.size() * sizeof(unsigned));
 
@@ -60,7 +37,7 @@ void Selectable::renderSelectionBox(const glm::mat4 &view, const glm::mat4 &proj
     _shader.use();
     _shader.setMat4("view", view);
     _shader.setMat4("projection", projection);
-    _shader.setMat4("model", _model);
+    _shader.setMat4("model", getModel());
     _shader.setVec3("color", glm::vec3(1.0, 0.0, 0.0));
 
     glEnable(GL_BLEND);
@@ -84,18 +61,6 @@ std::vector<PropertyPtr> Selectable::getProperties() const {
     return _properties;
 }
 
-AABB Selectable::getCollisionBox() const {
-    std::vector<glm::vec3> points = transformLocalBox();
-    glm::vec3 worldMin = points[0];
-    glm::vec3 worldMax = points[0];
-
-    for (const glm::vec3 &point: points) {
-        worldMin = min(worldMin, point);
-        worldMax = max(worldMax, point);
-    }
-    return {worldMin, worldMax};
-}
-
 Selectable::~Selectable() {
     glDeleteVertexArrays(1, &_VAO);
     glDeleteBuffers(1, &_VBO);
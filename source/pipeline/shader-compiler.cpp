@@ -0,0 +1,83 @@
+#include <glad.hpp>
+
+// Header File Include //
+#include "pipeline/shader-compiler.hpp"
+#include "pipeline/program-cache.hpp"
+#include "pipeline/shader.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <cstring>
+
+// GLFW Include //
+#include <GLFW/glfw3.h>
+
+// GL_KHR_parallel_shader_compile is not part of the generated loader
+constexpr unsigned MAX_SHADER_COMPILER_THREADS = 0x91B0;
+constexpr unsigned COMPLETION_STATUS = 0x91B1;
+
+using MaxShaderCompilerThreadsFunction = void (*)(unsigned);
+
+void ShaderCompiler::initialize() {
+    int extensions = 0;
+    int threads = 0;
+
+    _initialized = true;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+    for (int index = 0; index < extensions && !_parallel; index++) {
+        const auto *name = reinterpret_cast<const char *>(glGetStringi(GL_EXTENSIONS, index));
+
+        _parallel = name && (std::strcmp(name, "GL_KHR_parallel_shader_compile") == 0 ||
+                             std::strcmp(name, "GL_ARB_parallel_shader_compile") == 0);
+    }
+    if (!_parallel) {
+        _logger.info("Parallel shader compilation is not supported, programs are finalized one by one");
+        return;
+    }
+
+    auto maxThreads = reinterpret_cast<MaxShaderCompilerThreadsFunction>(
+        glfwGetProcAddress("glMaxShaderCompilerThreadsKHR"));
+    if (!maxThreads)
+        maxThreads = reinterpret_cast<MaxShaderCompilerThreadsFunction>(
+            glfwGetProcAddress("glMaxShaderCompilerThreadsARB"));
+    if (maxThreads)
+        maxThreads(0xFFFFFFFFu);
+    glGetIntegerv(MAX_SHADER_COMPILER_THREADS, &threads);
+    _logger.info("Parallel shader compilation enabled ({} threads)", threads);
+}
+
+void ShaderCompiler::submit(Shader &shader) {
+    if (!_initialized)
+        initialize();
+    if (std::ranges::find(_pending, &shader) == _pending.end())
+        _pending.push_back(&shader);
+}
+
+void ShaderCompiler::cancel(const Shader &shader) {
+    std::erase(_pending, &shader);
+}
+
+// Without the extension a program is always reported complete and finalizing it blocks on the driver
+bool ShaderCompiler::isComplete(const unsigned program) {
+    int complete = GL_TRUE;
+
+    if (!_initialized)
+        initialize();
+    if (_parallel)
+        glGetProgramiv(program, COMPLETION_STATUS, &complete);
+    return complete == GL_TRUE;
+}
+
+void ShaderCompiler::poll() {
+    std::erase_if(_pending, [](Shader *shader) { return shader->poll(); });
+    if (_pending.empty() && !_reported) {
+        ProgramCache::getInstance().report();
+        _reported = true;
+    }
+}
+
+void ShaderCompiler::finish() {
+    for (Shader *shader: _pending)
+        shader->wait();
+    poll();
+}
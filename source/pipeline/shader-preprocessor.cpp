@@ -0,0 +1,106 @@
+// Header File Include //
+#include "pipeline/shader-preprocessor.hpp"
+#include "exception/shader-exception.hpp"
+
+// STD Include //
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+
+std::string PreprocessedSource::mapLog(const std::string &log) const {
+    // Matches "0:12(3)" (Mesa), "0(12)" (NVIDIA) and "0:12:" (AMD) source string / line pairs
+    static const std::regex location(R"((^|\s)(\d+)(?::(\d+)|\((\d+)\)))");
+    std::string result;
+    auto last = log.cbegin();
+
+    for (std::sregex_iterator it(log.begin(), log.end(), location), end; it != end; ++it) {
+        const std::smatch &match = *it;
+        const size_t file = std::stoul(match[2].str());
+        const std::string line = match[3].matched ? match[3].str() : match[4].str();
+
+        if (file >= files.size())
+            continue;
+        result.append(last, match[0].first);
+        result += match[1].str() + files[file] + ":" + line;
+        last = match[0].second;
+    }
+    result.append(last, log.cend());
+    return result;
+}
+
+const std::string &ShaderPreprocessor::readFile(const std::string &path) {
+    if (const auto iterator = _files.find(path); iterator != _files.end())
+        return iterator->second;
+
+    std::ifstream file(path);
+    std::stringstream buffer;
+
+    if (!file.is_open())
+        throw ShaderException("Failed to open file: " + path);
+    buffer << file.rdbuf();
+    return _files.emplace(path, buffer.str()).first->second;
+}
+
+void ShaderPreprocessor::expand(const std::string &path, const std::vector<std::string> &defines,
+                                PreprocessedSource &source, std::unordered_set<std::string> &included,
+                                const int depth) {
+    const std::string &content = readFile(path);
+    const std::string fileIndex = std::to_string(source.files.size());
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    std::istringstream stream(content);
+    std::string line;
+    int lineNumber = 0;
+
+    if (depth > MAX_INCLUDE_DEPTH)
+        throw ShaderException("Shader include depth exceeded in " + path);
+    source.files.push_back(path);
+    if (depth > 0)
+        source.code += "#line 1 " + fileIndex + "\n";
+
+    while (std::getline(stream, line)) {
+        const size_t start = line.find_first_not_of(" \t");
+        const std::string_view directive = start == std::string::npos
+                                               ? std::string_view()
+                                               : std::string_view(line).substr(start);
+
+        lineNumber++;
+        if (directive.starts_with("#version")) {
+            source.code += line + "\n";
+            for (const auto &define: defines)
+                source.code += "#define " + define + "\n";
+            source.code += "#line " + std::to_string(lineNumber + 1) + " " + fileIndex + "\n";
+            continue;
+        }
+        if (!directive.starts_with("#include")) {
+            source.code += line + "\n";
+            continue;
+        }
+
+        const size_t open = line.find('"');
+        const size_t close = line.find('"', open + 1);
+
+        if (open == std::string::npos || close == std::string::npos)
+            throw ShaderException(path + ":" + std::to_string(lineNumber) + ": malformed #include");
+
+        const std::string includePath = (directory / line.substr(open + 1, close - open - 1)).lexically_normal().
+                string();
+
+        // Libraries are only pasted once per stage, like an implicit #pragma once
+        if (included.insert(includePath).second)
+            expand(includePath, {}, source, included, depth + 1);
+        source.code += "#line " + std::to_string(lineNumber + 1) + " " + fileIndex + "\n";
+    }
+}
+
+PreprocessedSource ShaderPreprocessor::process(const std::string &path, const std::vector<std::string> &defines) {
+    PreprocessedSource source;
+    std::unordered_set<std::string> included;
+
+    expand(std::filesystem::path(path).lexically_normal().string(), defines, source, included, 0);
+    return source;
+}
+
+void ShaderPreprocessor::invalidate(const std::string &path) {
+    _files.erase(std::filesystem::path(path).lexically_normal().string());
+}
@@ -0,0 +1,68 @@
+// Header File Include //
+#include "pipeline/shader-variants.hpp"
+
+// STD Include //
+#include <bit>
+#include <tuple>
+#include <utility>
+
+std::vector<std::string> getShaderDefines(const unsigned features) {
+    std::vector<std::string> defines;
+
+    if (features & SHADER_TEXTURED)
+        defines.emplace_back("TEXTURED");
+    if (features & SHADER_NORMAL_MAP)
+        defines.emplace_back("NORMAL_MAP");
+    defines.emplace_back("ILLUMINATION_MODEL " +
+                         std::to_string((features & SHADER_ILLUMINATION_MASK) >> SHADER_ILLUMINATION_SHIFT));
+    return defines;
+}
+
+ShaderVariants::ShaderVariants(std::string vertexPath, std::string fragmentPath, const unsigned featureMask)
+    : _vertexPath(std::move(vertexPath)), _fragmentPath(std::move(fragmentPath)), _featureMask(featureMask) {
+}
+
+Shader &ShaderVariants::submit(const unsigned features) {
+    if (const auto iterator = _variants.find(features); iterator != _variants.end())
+        return *iterator->second;
+
+    auto shader = std::make_unique<Shader>(_vertexPath.c_str(), _fragmentPath.c_str(), getShaderDefines(features));
+
+    shader->bindUniformBlock("Lights", LIGHTS_BLOCK_BINDING);
+    return *_variants.emplace(features, std::move(shader)).first->second;
+}
+
+// While a variant is compiling, the ready variant sharing the most features stands in for it
+Shader &ShaderVariants::get(unsigned features) {
+    features &= _featureMask;
+    Shader &shader = submit(features);
+    Shader *fallback = nullptr;
+    int bestScore = -1;
+
+    if (shader.isReady())
+        return shader;
+    for (const auto &[variantFeatures, variant]: _variants) {
+        const int score = std::popcount(~(variantFeatures ^ features) & _featureMask);
+
+        if (variant->isReady() && score > bestScore) {
+            fallback = variant.get();
+            bestScore = score;
+        }
+    }
+    if (fallback)
+        return *fallback;
+    shader.wait();
+    return shader;
+}
+
+void ShaderVariants::prepare(const unsigned features) {
+    std::ignore = submit(features & _featureMask);
+}
+
+unsigned ShaderVariants::reloadIfChanged(const std::vector<std::string> &files) {
+    unsigned reloaded = 0;
+
+    for (const auto &[features, shader]: _variants)
+        reloaded += shader->reloadIfChanged(files);
+    return reloaded;
+}
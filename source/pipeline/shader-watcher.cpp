@@ -0,0 +1,104 @@
+// Header File Include //
+#include "pipeline/shader-watcher.hpp"
+#include "pipeline/shader-preprocessor.hpp"
+
+// STD Include //
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+
+ShaderWatcher::ShaderWatcher(std::filesystem::path directory) : _directory(std::move(directory)) {
+    std::error_code error;
+
+    _descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (_descriptor < 0) {
+        _logger.warn("Shader hot-reload disabled, inotify unavailable: {}", std::strerror(errno));
+        return;
+    }
+
+    std::vector<std::filesystem::path> directories{_directory};
+    for (const auto &entry: std::filesystem::recursive_directory_iterator(_directory, error)) {
+        if (entry.is_directory())
+            directories.push_back(entry.path());
+    }
+    // Editors often save through a rename, so moves into the directory count as writes
+    for (const std::filesystem::path &path: directories) {
+        const int watch = inotify_add_watch(_descriptor, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+
+        if (watch >= 0)
+            _watches.emplace(watch, path);
+    }
+    _logger.info("Watching {} shader directories for changes", _watches.size());
+}
+
+std::vector<std::string> ShaderWatcher::poll() {
+    alignas(inotify_event) char buffer[4096];
+    std::vector<std::string> changed;
+    ssize_t length;
+
+    if (_descriptor < 0)
+        return changed;
+    while ((length = read(_descriptor, buffer, sizeof(buffer))) > 0) {
+        for (ssize_t offset = 0; offset < length;) {
+            const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+            const auto watch = _watches.find(event->wd);
+
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+            if (watch == _watches.end() || event->len == 0)
+                continue;
+
+            std::string path = (watch->second / event->name).lexically_normal().string();
+            if (std::ranges::find(changed, path) == changed.end())
+                changed.push_back(std::move(path));
+        }
+    }
+    for (const std::string &path: changed)
+        ShaderPreprocessor::getInstance().invalidate(path);
+    return changed;
+}
+
+ShaderWatcher::~ShaderWatcher() {
+    if (_descriptor >= 0)
+        close(_descriptor);
+}
+#else
+ShaderWatcher::ShaderWatcher(std::filesystem::path directory) : _directory(std::move(directory)) {
+    std::ignore = poll();
+    _logger.info("Watching {} shader files for changes", _timestamps.size());
+}
+
+std::vector<std::string> ShaderWatcher::poll() {
+    const auto now = std::chrono::steady_clock::now();
+    const bool initial = _timestamps.empty();
+    std::vector<std::string> changed;
+    std::error_code error;
+
+    if (!initial && now - _lastScan < SCAN_INTERVAL)
+        return changed;
+    _lastScan = now;
+    for (const auto &entry: std::filesystem::recursive_directory_iterator(_directory, error)) {
+        if (!entry.is_regular_file())
+            continue;
+
+        const std::string path = entry.path().lexically_normal().string();
+        const std::filesystem::file_time_type time = entry.last_write_time(error);
+        auto [timestamp, inserted] = _timestamps.try_emplace(path, time);
+
+        if (!inserted && timestamp->second != time) {
+            timestamp->second = time;
+            changed.push_back(path);
+        }
+    }
+    for (const std::string &path: changed)
+        ShaderPreprocessor::getInstance().invalidate(path);
+    return changed;
+}
+
+ShaderWatcher::~ShaderWatcher() = default;
+#endif
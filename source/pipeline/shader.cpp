@@ -2,76 +2,286 @@
 #include "glad.hpp"
 
 // STD Include //
-#include <fstream>
-#include <sstream>
+#include <algorithm>
+#include <chrono>
+#include <tuple>
 
 // GLFW Include //
 #include <GLFW/glfw3.h>
 
 #include "exception/shader-exception.hpp"
+#include "pipeline/program-cache.hpp"
+#include "pipeline/shader-compiler.hpp"
+#include "pipeline/shader-preprocessor.hpp"
 
-Shader::Shader(const char *vertexPath, const char *fragmentPath) {
-    const std::string vertexShaderSource = readShaderFile(vertexPath);
-    const std::string fragmentShaderSource = readShaderFile(fragmentPath);
+static double getElapsedMilliseconds(const std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Default block uniforms of a reloaded program start from the values the previous program held
+static void copyUniforms(const unsigned source, const unsigned destination) {
+    int count = 0;
+
+    glGetProgramiv(destination, GL_ACTIVE_UNIFORMS, &count);
+    for (int index = 0; index < count; index++) {
+        char buffer[256];
+        int length = 0;
+        int size = 0;
+        unsigned type = 0;
+
+        glGetActiveUniform(destination, index, sizeof(buffer), &length, &size, &type, buffer);
+        std::string name(buffer, length);
+        if (name.ends_with("[0]"))
+            name.resize(name.size() - 3);
+
+        for (int element = 0; element < size; element++) {
+            const std::string elementName = size > 1 ? name + '[' + std::to_string(element) + ']' : name;
+            const int from = glGetUniformLocation(source, elementName.c_str());
+            const int to = glGetUniformLocation(destination, elementName.c_str());
+            float floats[16];
+            int integer = 0;
+
+            if (from < 0 || to < 0)
+                continue;
+            switch (type) {
+                case GL_FLOAT:
+                case GL_FLOAT_VEC2:
+                case GL_FLOAT_VEC3:
+                case GL_FLOAT_VEC4:
+                case GL_FLOAT_MAT3:
+                case GL_FLOAT_MAT4:
+                    glGetUniformfv(source, from, floats);
+                    if (type == GL_FLOAT)
+                        glProgramUniform1fv(destination, to, 1, floats);
+                    else if (type == GL_FLOAT_VEC2)
+                        glProgramUniform2fv(destination, to, 1, floats);
+                    else if (type == GL_FLOAT_VEC3)
+                        glProgramUniform3fv(destination, to, 1, floats);
+                    else if (type == GL_FLOAT_VEC4)
+                        glProgramUniform4fv(destination, to, 1, floats);
+                    else if (type == GL_FLOAT_MAT3)
+                        glProgramUniformMatrix3fv(destination, to, 1, GL_FALSE, floats);
+                    else
+                        glProgramUniformMatrix4fv(destination, to, 1, GL_FALSE, floats);
+                    break;
+                case GL_INT:
+                case GL_BOOL:
+                case GL_SAMPLER_2D:
+                case GL_SAMPLER_CUBE:
+                case GL_SAMPLER_BUFFER:
+                case GL_UNSIGNED_INT_SAMPLER_BUFFER:
+                    glGetUniformiv(source, from, &integer);
+                    glProgramUniform1i(destination, to, integer);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
 
-    if (vertexShaderSource.empty() || fragmentShaderSource.empty())
+Shader::Shader(const char *vertexPath, const char *fragmentPath, const std::vector<std::string> &defines)
+    : _vertexPath(vertexPath), _fragmentPath(fragmentPath), _defines(defines) {
+    const auto start = std::chrono::steady_clock::now();
+    ShaderPreprocessor &preprocessor = ShaderPreprocessor::getInstance();
+    PreprocessedSource vertexShaderSource = preprocessor.process(vertexPath, defines);
+    PreprocessedSource fragmentShaderSource = preprocessor.process(fragmentPath, defines);
+    ProgramCache &programCache = ProgramCache::getInstance();
+
+    if (vertexShaderSource.code.empty() || fragmentShaderSource.code.empty())
         throw ShaderException("Failed to load shader source files");
 
-    // Compile Vertex Shader //
+    _cacheKey = programCache.makeKey(vertexShaderSource.code, fragmentShaderSource.code);
+    trackFiles(vertexShaderSource, fragmentShaderSource);
+    _id = glCreateProgram();
+    if (programCache.load(_id, _cacheKey)) {
+        programCache.recordLoad(getElapsedMilliseconds(start));
+        return;
+    }
+    _pending = submit(_id, std::move(vertexShaderSource), std::move(fragmentShaderSource), _cacheKey, start);
+    ShaderCompiler::getInstance().submit(*this);
+}
+
+std::unique_ptr<PendingProgram> Shader::submit(const unsigned program, PreprocessedSource vertexSource,
+                                               PreprocessedSource fragmentSource, std::string cacheKey,
+                                               const std::chrono::steady_clock::time_point start) {
+    // Submit Vertex Shader //
     const unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    const char *vertexSourceCStr = vertexShaderSource.c_str();
+    const char *vertexSourceCStr = vertexSource.code.c_str();
     glShaderSource(vertexShader, 1, &vertexSourceCStr, nullptr);
     glCompileShader(vertexShader);
-    checkCompileErrors(vertexShader, "VERTEX");
 
-    // Compile Fragment Shader //
+    // Submit Fragment Shader //
     const unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    const char *fragmentSourceCStr = fragmentShaderSource.c_str();
+    const char *fragmentSourceCStr = fragmentSource.code.c_str();
     glShaderSource(fragmentShader, 1, &fragmentSourceCStr, nullptr);
     glCompileShader(fragmentShader);
-    checkCompileErrors(fragmentShader, "FRAGMENT");
 
-    // Link Shaders //
-    _id = glCreateProgram();
-    glAttachShader(_id, vertexShader);
-    glAttachShader(_id, fragmentShader);
-    glLinkProgram(_id);
-    checkCompileErrors(_id, "PROGRAM");
+    // Submit Link, status is only queried once the compiler reports completion //
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glLinkProgram(program);
+
+    return std::make_unique<PendingProgram>(PendingProgram{
+        program, vertexShader, fragmentShader, std::move(cacheKey), std::move(vertexSource),
+        std::move(fragmentSource), start
+    });
+}
+
+void Shader::trackFiles(const PreprocessedSource &vertexSource, const PreprocessedSource &fragmentSource) {
+    _files = vertexSource.files;
+    for (const std::string &file: fragmentSource.files) {
+        if (std::ranges::find(_files, file) == _files.end())
+            _files.push_back(file);
+    }
+}
+
+bool Shader::link(const PendingProgram &pending) const {
+    bool success = checkCompileErrors(pending.vertexShader, "VERTEX", &pending.vertexSource);
+
+    success = checkCompileErrors(pending.fragmentShader, "FRAGMENT", &pending.fragmentSource) && success;
+    success = checkCompileErrors(pending.program, "PROGRAM") && success;
+
+    glDetachShader(pending.program, pending.vertexShader);
+    glDetachShader(pending.program, pending.fragmentShader);
+    glDeleteShader(pending.vertexShader);
+    glDeleteShader(pending.fragmentShader);
+    return success;
+}
+
+void Shader::applyUniformBlocks(const unsigned program) const {
+    for (const auto &[name, binding]: _uniformBlocks) {
+        const unsigned index = glGetUniformBlockIndex(program, name.c_str());
+
+        if (index != GL_INVALID_INDEX)
+            glUniformBlockBinding(program, index, binding);
+    }
+}
+
+bool Shader::poll() {
+    ShaderCompiler &compiler = ShaderCompiler::getInstance();
+
+    if (_pending) {
+        if (!compiler.isComplete(_pending->program))
+            return false;
+        finalize();
+    }
+    if (_reload) {
+        if (!compiler.isComplete(_reload->program))
+            return false;
+        swapReload();
+    }
+    return true;
+}
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+void Shader::wait() const {
+    if (_pending)
+        finalize();
 }
 
-std::string Shader::readShaderFile(const std::string &filePath) {
-    std::ifstream file(filePath);
-    std::stringstream buffer;
+void Shader::finalize() const {
+    const std::unique_ptr<PendingProgram> pending = std::move(_pending);
+    ProgramCache &programCache = ProgramCache::getInstance();
+
+    std::ignore = link(*pending);
+    applyUniformBlocks(_id);
+    programCache.store(_id, pending->cacheKey);
+    programCache.recordCompile(getElapsedMilliseconds(pending->start));
+}
+
+// The previous program stays bound until the new one links, a broken edit never replaces a working program
+void Shader::swapReload() {
+    const std::unique_ptr<PendingProgram> reload = std::move(_reload);
+
+    if (!link(*reload)) {
+        glDeleteProgram(reload->program);
+        _logger.warn("Shader reload failed, keeping the previous program for {}", _fragmentPath);
+        return;
+    }
+    copyUniforms(_id, reload->program);
+    applyUniformBlocks(reload->program);
+    ProgramCache::getInstance().store(reload->program, reload->cacheKey);
+    if (reload->cacheKey != _cacheKey)
+        ProgramCache::getInstance().remove(_cacheKey);
+    _cacheKey = reload->cacheKey;
+    glDeleteProgram(_id);
+    _id = reload->program;
+    _logger.info("Reloaded {} in {:.1f} ms", _fragmentPath, getElapsedMilliseconds(reload->start));
+}
 
-    if (!file.is_open())
-        throw ShaderException("Failed to open file: " + filePath);
-    buffer << file.rdbuf();
-    return buffer.str();
+bool Shader::dependsOn(const std::vector<std::string> &files) const {
+    return std::ranges::any_of(files, [this](const std::string &file) {
+        return std::ranges::find(_files, file) != _files.end();
+    });
 }
 
-void Shader::checkCompileErrors(const unsigned int shader, const std::string &type) const {
-    char infoLog[512];
+bool Shader::reloadIfChanged(const std::vector<std::string> &files) {
+    const auto start = std::chrono::steady_clock::now();
+    ShaderPreprocessor &preprocessor = ShaderPreprocessor::getInstance();
+    ProgramCache &programCache = ProgramCache::getInstance();
+    PreprocessedSource vertexShaderSource;
+    PreprocessedSource fragmentShaderSource;
+
+    if (!dependsOn(files))
+        return false;
+    // A bad include in the edited file keeps the previous program, like a compile error does
+    try {
+        vertexShaderSource = preprocessor.process(_vertexPath, _defines);
+        fragmentShaderSource = preprocessor.process(_fragmentPath, _defines);
+    } catch (const ShaderException &exception) {
+        _logger.warn("Shader reload skipped, keeping the previous program for {}: {}", _fragmentPath,
+                     exception.what());
+        return false;
+    }
+    if (vertexShaderSource.code.empty() || fragmentShaderSource.code.empty()) {
+        _logger.warn("Shader reload skipped, cannot read {} or {}", _vertexPath, _fragmentPath);
+        return false;
+    }
+
+    std::string cacheKey = programCache.makeKey(vertexShaderSource.code, fragmentShaderSource.code);
+    const unsigned program = glCreateProgram();
+
+    trackFiles(vertexShaderSource, fragmentShaderSource);
+    if (_reload) {
+        glDeleteShader(_reload->vertexShader);
+        glDeleteShader(_reload->fragmentShader);
+        glDeleteProgram(_reload->program);
+    }
+    _reload = submit(program, std::move(vertexShaderSource), std::move(fragmentShaderSource), std::move(cacheKey),
+                     start);
+    ShaderCompiler::getInstance().submit(*this);
+    return true;
+}
+
+bool Shader::checkCompileErrors(const unsigned int shader, const std::string &type,
+                                const PreprocessedSource *source) const {
+    std::string infoLog;
+    int length = 0;
     int success;
 
     if (type == "PROGRAM") {
-        glGetProgramiv(_id, GL_LINK_STATUS, &success);
+        glGetProgramiv(shader, GL_LINK_STATUS, &success);
         if (!success) {
-            glGetShaderInfoLog(shader, 512, nullptr, infoLog);
-            _logger.error("Shader ({}): {}", type, infoLog);
+            glGetProgramiv(shader, GL_INFO_LOG_LENGTH, &length);
+            infoLog.resize(std::max(length, 1));
+            glGetProgramInfoLog(shader, length, nullptr, infoLog.data());
+            _logger.error("Shader ({}): {}", type, infoLog.c_str());
         }
-        return;
+        return success;
     }
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
     if (!success) {
-        glGetShaderInfoLog(shader, 512, nullptr, infoLog);
-        _logger.warn("Shader ({}): {}", type, infoLog);
+        glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+        infoLog.resize(std::max(length, 1));
+        glGetShaderInfoLog(shader, length, nullptr, infoLog.data());
+        _logger.warn("Shader ({}): {}", type, source ? source->mapLog(infoLog.c_str()) : infoLog.c_str());
     }
+    return success;
 }
 
 void Shader::use() const {
+    wait();
     glUseProgram(_id);
 }
 
@@ -79,6 +289,13 @@ unsigned int Shader::getId() const {
     return _id;
 }
 
+void Shader::bindUniformBlock(const std::string &name, const unsigned binding) {
+    std::erase_if(_uniformBlocks, [&name](const auto &block) { return block.first == name; });
+    _uniformBlocks.emplace_back(name, binding);
+    if (!_pending)
+        applyUniformBlocks(_id);
+}
+
 void Shader::setBool(const std::string &name, const bool value) const {
     glUniform1i(glGetUniformLocation(_id, name.c_str()), static_cast<int>(value));
 }
@@ -126,3 +343,8 @@ void Shader::setMat3(const std::string &name, const glm::mat3 &mat) const {
 void Shader::setMat4(const std::string &name, const glm::mat4 &mat) const {
     glUniformMatrix4fv(glGetUniformLocation(_id, name.c_str()), 1, GL_FALSE, &mat[0][0]);
 }
+
+Shader::~Shader() {
+    if (_pending || _reload)
+        ShaderCompiler::getInstance().cancel(*this);
+}
@@ -5,7 +5,6 @@
 
 #include <stb_image.hpp>
 
-#include "application/menu/scene-menu.hpp"
 
 constexpr std::array skyboxVertices = {
     -1.0f, 1.0f, -1.0f,
@@ -66,10 +65,6 @@ void Skybox::render(const unsigned int cubeMapTexture, const glm::mat4 &view, co
     _shader.setMat4("view", view);
     _shader.setMat4("projection", projection);
 
-    auto &[enableToneMapping, toneMappingExposure] = ToneMappingSettings::instance();
-    _shader.setBool("enableToneMapping", enableToneMapping);
-    _shader.setFloat("toneMappingExposure", toneMappingExposure);
-
     glDepthFunc(GL_LEQUAL);
     glBindVertexArray(_vao);
     glBindTexture(GL_TEXTURE_CUBE_MAP, cubeMapTexture);
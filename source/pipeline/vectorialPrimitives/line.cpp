@@ -26,7 +26,7 @@ AABB Line::getLocalBox() const {
 void Line::render(const glm::mat4& view, const glm::mat4& projection) {
     Primitive::render(view, projection);
 
-    _shader.setVec3("color", _color);
+    _shader->setVec3("color", getColor());
     glBindVertexArray(_VAO);
     glDrawArrays(GL_LINES, 0, 2);
     glBindVertexArray(0);
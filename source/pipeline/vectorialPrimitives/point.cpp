@@ -20,13 +20,13 @@ Point::Point()
 }
 
 AABB Point::getLocalBox() const {
-    return {getPosition(), getPosition()};
+    return {glm::vec3(0.0f), glm::vec3(0.0f)};
 }
 
 void Point::render(const glm::mat4& view, const glm::mat4& projection) {
     Primitive::render(view, projection);
 
-    _shader.setVec3("color", _color);
+    _shader->setVec3("color", getColor());
     glBindVertexArray(_VAO);
     glDrawArrays(GL_POINTS, 0, 1);
     glBindVertexArray(0);
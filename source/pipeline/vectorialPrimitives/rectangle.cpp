@@ -33,7 +33,7 @@ AABB Rectangle::getLocalBox() const {
 void Rectangle::render(const glm::mat4 &view, const glm::mat4 &projection) {
     Primitive::render(view, projection);
 
-    _shader.setVec3("color", _color);
+    _shader->setVec3("color", getColor());
     glBindVertexArray(_VAO);
     glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
     glBindVertexArray(0);
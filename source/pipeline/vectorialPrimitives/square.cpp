@@ -38,7 +38,7 @@ AABB Square::getLocalBox() const {
 void Square::render(const glm::mat4 &view, const glm::mat4 &projection) {
     Primitive::render(view, projection);
 
-    _shader.setVec3("color", _color);
+    _shader->setVec3("color", getColor());
     glBindVertexArray(_VAO);
     glDrawArrays(GL_TRIANGLES, 0, 6);
     glBindVertexArray(0);
@@ -27,7 +27,7 @@ AABB Triangle::getLocalBox() const {
 void Triangle::render(const glm::mat4 &view, const glm::mat4 &projection) {
     Primitive::render(view, projection);
 
-    _shader.setVec3("color", _color);
+    _shader->setVec3("color", getColor());
     glBindVertexArray(_VAO);
     glDrawArrays(GL_TRIANGLES, 0, 3);
     glBindVertexArray(0);
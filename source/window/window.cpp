@@ -4,7 +4,20 @@
 // ImGui Include //
 #include <imgui.h>
 
-Window::Window(const int width, const int height) : _width{width}, _height{height}, _cursor(nullptr) {
+// STD Include //
+#include <cstdlib>
+
+Window::Window(const int width, const int height, const bool headless)
+    : _width{width}, _height{height}, _cursor(nullptr) {
+#if GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4)
+    const bool hasDisplay = std::getenv("DISPLAY") != nullptr || std::getenv("WAYLAND_DISPLAY") != nullptr;
+    const bool nullPlatform = headless && !hasDisplay && glfwPlatformSupported(GLFW_PLATFORM_NULL);
+
+    if (nullPlatform) {
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+        _logger.info("No display available, rendering through OSMesa");
+    }
+#endif
     if (!glfwInit()) {
         _logger.critical("Failed to initialize GLFW.");
         return;
@@ -13,10 +26,17 @@ Window::Window(const int width, const int height) : _width{width}, _height{heigh
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+#if GLFW_VERSION_MAJOR > 3 || (GLFW_VERSION_MAJOR == 3 && GLFW_VERSION_MINOR >= 4)
+    // Window hints are only accepted once GLFW is initialized
+    if (nullPlatform)
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
 
 #ifdef __APPLE__
         glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+    if (headless)
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
 
     _window = glfwCreateWindow(_width, _height, "Infographie", nullptr, nullptr);
     if (_window == nullptr) {
@@ -25,6 +45,8 @@ Window::Window(const int width, const int height) : _width{width}, _height{heigh
         return;
     }
     glfwMakeContextCurrent(_window);
+    if (headless)
+        glfwSwapInterval(0);
     glfwSetWindowUserPointer(_window, this);
     glfwSetInputMode(_window, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
     glfwSetFramebufferSizeCallback(_window, [](GLFWwindow *, const int frameWidth, const int frameHeight) {
@@ -106,19 +128,7 @@ void Window::handleMouseCallback(const double deltaX, const double deltaY) {
     _lastX = xPosition;
     _lastY = yPosition;
 
-    _yaw += xOffset;
-    _pitch += yOffset;
-
-    if (_pitch > 89.0f)
-        _pitch = 89.0f;
-    if (_pitch < -89.0f)
-        _pitch = -89.0f;
-    _cameraMouseDirection = normalize(glm::vec3(
-        cos(glm::radians(_yaw)) * cos(glm::radians(_pitch)),
-        sin(glm::radians(_pitch)),
-        sin(glm::radians(_yaw)) * cos(glm::radians(_pitch))
-    ));
-
+    setCameraOrientation(_yaw + xOffset, _pitch + yOffset);
     setCursor(CursorType::RESIZE_ALL);
 }
 
@@ -193,12 +203,10 @@ glm::mat4 Window::getProjection() const {
     const float aspectRatio = getAspectRatio();
     const float orthoWidth = static_cast<float>(_width) / 200.0f;
     const float orthoWHeight = static_cast<float>(_height) / 200.0f;
-    constexpr float zNear = 0.1f;
-    constexpr float zFar = 100.0f;
 
     if (_projectionMode == PERSPECTIVE)
-        return glm::perspective(glm::radians(_fov), aspectRatio, zNear, zFar);
-    return glm::ortho(-orthoWidth, orthoWidth, -orthoWHeight, orthoWHeight, zNear, zFar);
+        return glm::perspective(glm::radians(_fov), aspectRatio, Z_NEAR, Z_FAR);
+    return glm::ortho(-orthoWidth, orthoWidth, -orthoWHeight, orthoWHeight, Z_NEAR, Z_FAR);
 }
 
 glm::mat4 Window::getView() const {
@@ -213,6 +221,21 @@ void Window::setCameraPosition(const glm::vec3 newPosition) {
     _cameraPosition += newPosition;
 }
 
+void Window::setCameraOrientation(const float yaw, const float pitch) {
+    _yaw = yaw;
+    _pitch = pitch;
+
+    if (_pitch > 89.0f)
+        _pitch = 89.0f;
+    if (_pitch < -89.0f)
+        _pitch = -89.0f;
+    _cameraMouseDirection = normalize(glm::vec3(
+        cos(glm::radians(_yaw)) * cos(glm::radians(_pitch)),
+        sin(glm::radians(_pitch)),
+        sin(glm::radians(_yaw)) * cos(glm::radians(_pitch))
+    ));
+}
+
 void Window::setDeltaTime(const float newDeltaTime) {
     _deltaTime = newDeltaTime;
 }
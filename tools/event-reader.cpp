@@ -0,0 +1,138 @@
+// Header File Include //
+#include "application/event-format.hpp"
+
+// STD Include //
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Converts event log segments to CSV, or to a JSON array with --json, segments are read in the given order
+// Usage: project_event_reader [--json] [--output=path] run-0000.evlog run-0001.evlog...
+
+struct ReaderOptions {
+    bool json = false;
+    std::string outputPath;
+    std::vector<std::string> files;
+};
+
+// CSV doubles its quotes, JSON escapes them
+static std::string escapeName(const std::string_view name, const bool json) {
+    std::string escaped;
+
+    for (const char character: name) {
+        if (character == '"' || (json && character == '\\'))
+            escaped += json ? '\\' : '"';
+        escaped += character;
+    }
+    return escaped;
+}
+
+static std::string formatRecord(const EventHeader &header, const double *values, const std::string_view name,
+                                const bool json, const bool first) {
+    const double milliseconds = static_cast<double>(header.time) / 1000000.0;
+    std::string line;
+
+    if (!json) {
+        line = std::format("{},{},{:.6f},\"{}\"", eventTypeNames[header.type], header.frame, milliseconds,
+                           escapeName(name, false));
+        for (unsigned index = 0; index < MAX_EVENT_VALUES; index++)
+            line += index < header.valueCount ? std::format(",{}", values[index]) : ",";
+        return line + '\n';
+    }
+    line = std::format("{}\n  {{\"type\": \"{}\", \"frame\": {}, \"timeMs\": {:.6f}", first ? "" : ",",
+                       eventTypeNames[header.type], header.frame, milliseconds);
+    if (!name.empty())
+        line += std::format(", \"name\": \"{}\"", escapeName(name, true));
+    for (unsigned index = 0; index < header.valueCount; index++) {
+        const char *valueName = eventValueNames[header.type][index];
+
+        line += valueName != nullptr ? std::format(", \"{}\": {}", valueName, values[index])
+                                     : std::format(", \"value{}\": {}", index, values[index]);
+    }
+    return line + '}';
+}
+
+// Stops at the first zero size, which is where a segment that was not closed cleanly ends
+static bool convertSegment(const std::string &filename, std::ostream &output, const bool json, bool &first) {
+    std::ifstream file(filename, std::ios::binary);
+    const std::vector<char> data((std::istreambuf_iterator(file)), std::istreambuf_iterator<char>());
+    EventFileHeader fileHeader{};
+    size_t offset = sizeof(fileHeader);
+
+    if (!file.is_open() || data.size() < sizeof(fileHeader)) {
+        std::cerr << "Cannot read " << filename << '\n';
+        return false;
+    }
+    std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+    if (fileHeader.magic != EVENT_FILE_MAGIC || fileHeader.version != EVENT_FILE_VERSION) {
+        std::cerr << filename << " is not a version " << EVENT_FILE_VERSION << " event log\n";
+        return false;
+    }
+    while (offset + sizeof(EventHeader) <= data.size()) {
+        EventHeader header{};
+        double values[MAX_EVENT_VALUES]{};
+
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+        const size_t valuesSize = header.valueCount * sizeof(double);
+
+        if (header.size == 0)
+            break;
+        if (header.size < sizeof(header) + valuesSize || offset + header.size > data.size() ||
+            header.type >= EVENT_TYPE_COUNT || header.valueCount > MAX_EVENT_VALUES) {
+            std::cerr << filename << ": corrupt record at offset " << offset << '\n';
+            return false;
+        }
+        std::memcpy(values, data.data() + offset + sizeof(header), valuesSize);
+        const char *name = data.data() + offset + sizeof(header) + valuesSize;
+        const std::string_view nameView(name, strnlen(name, header.size - sizeof(header) - valuesSize));
+
+        output << formatRecord(header, values, nameView, json, first);
+        first = false;
+        offset += header.size;
+    }
+    return true;
+}
+
+int main(const int argc, char **argv) {
+    ReaderOptions options;
+    std::ofstream file;
+    bool first = true;
+    bool success = true;
+
+    for (int index = 1; index < argc; index++) {
+        const std::string_view argument = argv[index];
+
+        if (argument == "--json")
+            options.json = true;
+        else if (argument.starts_with("--output="))
+            options.outputPath = argument.substr(9);
+        else
+            options.files.emplace_back(argument);
+    }
+    if (options.files.empty()) {
+        std::cerr << "Usage: " << argv[0] << " [--json] [--output=path] segment.evlog...\n";
+        return 1;
+    }
+    if (!options.outputPath.empty()) {
+        file.open(options.outputPath, std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Cannot write " << options.outputPath << '\n';
+            return 1;
+        }
+    }
+    std::ostream &output = file.is_open() ? file : std::cout;
+
+    if (options.json)
+        output << '[';
+    else
+        output << "type,frame,timeMs,name,value0,value1,value2,value3,value4\n";
+    for (const std::string &filename: options.files)
+        success &= convertSegment(filename, output, options.json, first);
+    if (options.json)
+        output << (first ? "]\n" : "\n]\n");
+    return success ? 0 : 1;
+}